@@ -13,16 +13,31 @@
 // std libs
 #include <string.h>
 /****************************************************************/
+#include "OW_temp_pipeline.h"
+#include "OW_temp_alarm.h"
+/****************************************************************/
+
 
+#if OW_DEV_POOL
+/*!\struct DS1825_inst_t
+** \brief DS1825 pool instance
+**/
+typedef struct {
+	DS1825_t	cpnt;	//!< DS1825 User structure (first member: instance address is user structure address)
+	OW_slave_t	hal;	//!< DS1825 Slave structure
+} DS1825_inst_t;
 
+static OW_dev_pool_class_t DS1825_pool = OW_DEV_POOL_CLASS(DS1825_inst_t);	//!< DS1825 instances pool class
+#else
 static OW_slave_t DS1825_hal[OW_DS1825_NB] = { 0 };								//!< DS1825 Slave structure
 DS1825_t DS1825[OW_DS1825_NB] = { 0 };											//!< DS1825 User structure
+#endif
 
 static const uint16_t DS1825_convTimes[] = { 94, 188, 375, 750 };				//!< DS1825 conversion times (in ms)
 
 static const OW_temp_props_t DS1825_temp_props = {
 	DS1825_convTimes, OW_TEMP__RES_9BIT, OW_TEMP__RES_12BIT,
-	DS1825__GRANULARITY, 3 };													//!< DS1825 temperature sensor parameters
+	DS1825__GRANULARITY, 3, DS1825__FRAC_BITS };								//!< DS1825 temperature sensor parameters
 
 static const OW_ROM_type DS1825_FAMILY_CODE = OW_TYPE__THERMOMETER__4BIT_ID;	//!< DS1825 family code
 
@@ -88,28 +103,92 @@ __WEAK FctERR NONNULL__ DS1825_Init_Sequence(DS1825_t * const pCpnt)
 	return err;
 }
 
-FctERR NONNULL__ DS1825_Init(const uint8_t idx, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
+/*!\brief DS1825 peripheral instance initialization
+** \param[in,out] pCpnt - Pointer to DS1825 peripheral
+** \param[in,out] pSlave - Pointer to DS1825 slave structure
+** \param[in] pOW - pointer to OneWire driver instance
+** \param[in] pROM - Pointer to ROM Id structure
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ DS1825_Init_Instance(DS1825_t * const pCpnt, OW_slave_t * const pSlave, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
 {
 	FctERR err = ERROR_DEVICE_UNKNOWN;
 
-	assert_param(IS_OW_PERIPHERAL(DS1825, idx));
-
 	if (pROM->familyCode == DS1825_FAMILY_CODE)	// Family code matches
 	{
-		OW_slave_init(&DS1825_hal[idx], pOW, pROM);
-		OW_SN_SET_DEFAULTS(DS1825, idx, pROM);
-		OW_TEMP_SET_DEFAULTS(DS1825, idx);
+		err = OW_slave_init(pSlave, pOW, pROM);
 
-		err = DS1825_Init_Sequence(&DS1825[idx]);
+		if (err == ERROR_OK)
+		{
+			OW_SN_SET_DEFAULTS(pCpnt, pSlave, pROM);
+			OW_TEMP_SET_DEFAULTS(DS1825, pCpnt, pSlave);
+
+			err = DS1825_Init_Sequence(pCpnt);
+		}
 	}
 
-	if (err != ERROR_OK)	{ OW_set_enable(&DS1825_hal[idx], false); }
+	if (err != ERROR_OK)	{ OW_set_enable(pSlave, false); }
 
 	return err;
 }
 
+#if OW_DEV_POOL
+FctERR NONNULL__ DS1825_New(OW_DRV * const pOW, const OW_ROM_ID_t * const pROM, DS1825_t ** const ppCpnt)
+{
+	DS1825_inst_t *	pInst;
+	FctERR			err = ERROR_OK;
+
+	*ppCpnt = NULL;
+
+	if (pROM->familyCode != DS1825_FAMILY_CODE)	{ err = ERROR_DEVICE_UNKNOWN; }	// Declined without allocation
+	if (err != ERROR_OK)						{ goto ret; }
+
+	pInst = (DS1825_inst_t *) OW_Dev_Pool_Alloc(&DS1825_pool);
+
+	if (pInst == NULL)	{ err = ERROR_MEMORY; }
+	else
+	{
+		err = DS1825_Init_Instance(&pInst->cpnt, &pInst->hal, pOW, pROM);
+
+		if (err == ERROR_OK)	{ *ppCpnt = &pInst->cpnt; }
+		else
+		{
+			OW_slave_deinit(&pInst->hal);
+			OW_Dev_Pool_Free(&DS1825_pool, pInst);
+		}
+	}
+
+	ret:
+	return err;
+}
+
+FctERR NONNULL__ DS1825_Delete(DS1825_t * const pCpnt)
+{
+	DS1825_inst_t * const	pInst = (DS1825_inst_t *) pCpnt;	// User structure is first member of pool instance
+	FctERR					err = ERROR_OK;
+
+	if (OW_is_busy(&pInst->hal))	{ err = ERROR_BUSY; }	// Transaction ongoing on device
+	if (err == ERROR_OK)			{ err = OW_TEMP_Pipeline_Unregister(&pCpnt->temp); }
+	if (err == ERROR_OK)			{ err = OW_TEMP_Alarm_Unregister(&pCpnt->temp); }
+	if (err != ERROR_OK)			{ goto ret; }
+
+	OW_slave_deinit(&pInst->hal);
+	OW_Dev_Pool_Free(&DS1825_pool, pInst);
+
+	ret:
+	return err;
+}
+#else
+FctERR NONNULL__ DS1825_Init(const uint8_t idx, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
+{
+	assert_param(IS_OW_PERIPHERAL(DS1825, idx));
+
+	return DS1825_Init_Instance(&DS1825[idx], &DS1825_hal[idx], pOW, pROM);
+}
+
 FctERR DS1825_Init_Single(const OW_ROM_ID_t * const pROM) {
 	return DS1825_Init(0, OW_DS1825, pROM); }
+#endif
 
 
 /****************************************************************/
@@ -15,6 +15,7 @@
 #include "sarmfsw.h"
 
 #include "OW_component.h"
+#include "OW_dev_pool.h"
 #include "OW_dev_sn.h"
 #include "OW_dev_temp.h"
 /****************************************************************/
@@ -22,7 +23,7 @@
 
 #ifndef OW_DS1825_NB
 //! \note Define OW_DS1825_NB_NB to enable multiple peripherals of this type
-#define OW_DS1825_NB	1U	//!< Number of DS1825 peripherals
+#define OW_DS1825_NB	1U	//!< Number of DS1825 peripherals (static instances, unused with OW_DEV_POOL)
 #endif
 
 
@@ -30,6 +31,7 @@
 // Section: Constants
 // *****************************************************************************
 #define DS1825__GRANULARITY		0.0625f		//!< DS1825 temperature sensor granularity
+#define DS1825__FRAC_BITS		4U			//!< DS1825 temperature register fractional bits (granularity = 2^-4)
 
 
 // *****************************************************************************
@@ -60,7 +62,9 @@ typedef struct {
 	uint8_t		location;	//!< Device location (defined by hardware pin coding)
 } DS1825_t;
 
+#if !OW_DEV_POOL
 extern DS1825_t DS1825[OW_DS1825_NB];	//!< DS1825 User structure
+#endif
 
 
 // *****************************************************************************
@@ -97,6 +101,25 @@ FctERR NONNULL__ DS1825_Configuration_Setter_Callback(DS1825_t * const pCpnt);
 **/
 FctERR NONNULL__ DS1825_Init_Sequence(DS1825_t * const pCpnt);
 
+#if OW_DEV_POOL
+/*!\brief DS1825 peripheral instance creation (allocated from device pool & initialized)
+** \param[in] pOW - pointer to OneWire driver instance
+** \param[in] pROM - Pointer to ROM Id structure
+** \param[out] ppCpnt - Pointer to created DS1825 peripheral pointer (NULL on failure)
+** \return FctERR - error code
+** \retval ERROR_DEVICE_UNKNOWN - ROM Id family code not matching (nothing allocated)
+** \retval ERROR_MEMORY - Device pool exhausted
+**/
+FctERR NONNULL__ DS1825_New(OW_DRV * const pOW, const OW_ROM_ID_t * const pROM, DS1825_t ** const ppCpnt);
+
+/*!\brief DS1825 peripheral instance deletion (removed device)
+** \note Instance is removed from temperature pipeline & alarm polling, slave lock identifier is released & instance is returned to device pool
+** \param[in,out] pCpnt - Pointer to DS1825 peripheral (created with \ref DS1825_New)
+** \return FctERR - error code
+** \retval ERROR_BUSY - Device transaction ongoing, or pipeline or alarm cycle ongoing on bus, instance kept (to be called again later)
+**/
+FctERR NONNULL__ DS1825_Delete(DS1825_t * const pCpnt);
+#else
 /*!\brief Initialization for DS1825 peripheral
 ** \param[in] idx - DS1825 index
 ** \param[in] pOW - pointer to OneWire driver instance
@@ -111,6 +134,7 @@ FctERR NONNULL__ DS1825_Init(const uint8_t idx, OW_DRV * const pOW, const OW_ROM
 ** \return FctERR - error code
 **/
 FctERR DS1825_Init_Single(const OW_ROM_ID_t * const pROM);
+#endif
 
 
 /*************************************/
@@ -125,6 +149,37 @@ FctERR DS1825_Init_Single(const OW_ROM_ID_t * const pROM);
 FctERR NONNULL__ DS1825_Set_Resolution(DS1825_t * const pCpnt, const OW_temp_res resolution);
 
 
+/*!\brief DS1825 write mode setter
+** \note \ref OW_TEMP__WRITE_VOLATILE mode only updates scratchpad (no EEPROM wear), use \ref DS1825_Persist to store configuration
+** \param[in,out] pCpnt - Pointer to DS1825 peripheral
+** \param[in] mode - Scratchpad write mode
+**/
+__INLINE void NONNULL_INLINE__ DS1825_Set_Write_Mode(DS1825_t * const pCpnt, const OW_temp_write_mode mode) {
+	OW_TEMP_Set_Write_Mode(&pCpnt->temp, mode); }
+
+/*!\brief DS1825 persist scratchpad configuration (resolution & alarms) to EEPROM
+** \param[in,out] pCpnt - Pointer to DS1825 peripheral
+** \return FctERR - Error code
+**/
+__INLINE FctERR NONNULL_INLINE__ DS1825_Persist(DS1825_t * const pCpnt) {
+	return OW_TEMP_Persist(&pCpnt->temp); }
+
+
+/*!\brief DS1825 adaptive resolution setter
+** \note Resolution is lowered while temperature changes fast and raised when stable (scratchpad only, no EEPROM wear)
+** \param[in,out] pCpnt - Pointer to DS1825 peripheral
+** \param[in] minRes - Minimum resolution (used while temperature changes fast)
+** \param[in] maxRes - Maximum resolution (used while temperature is stable)
+** \param[in] rateLow - Rate of change under which resolution is raised (raw register units per second)
+** \param[in] rateHigh - Rate of change above which resolution is lowered (raw register units per second)
+** \param[in] hold - Number of consecutive conversions beyond threshold before changing resolution
+** \return FctERR - Error code
+**/
+__INLINE FctERR NONNULL_INLINE__ DS1825_Set_Adaptive_Resolution(DS1825_t * const pCpnt, const OW_temp_res minRes, const OW_temp_res maxRes,
+																const uint32_t rateLow, const uint32_t rateHigh, const uint8_t hold) {
+	return OW_TEMP_Set_Adaptive_Resolution(&pCpnt->temp, minRes, maxRes, rateLow, rateHigh, hold); }
+
+
 /*!\brief DS1825 conversion mode setter (single/automatic)
 ** \param[in,out] pCpnt - Pointer to DS1825 peripheral
 ** \param[in] automatic - Automatic conversion enable flag
@@ -132,6 +187,14 @@ FctERR NONNULL__ DS1825_Set_Resolution(DS1825_t * const pCpnt, const OW_temp_res
 __INLINE void NONNULL__ DS1825_Set_Conversion_Mode(DS1825_t * const pCpnt, const bool automatic) {
 	OW_TEMP_Set_Conversion_Mode(&pCpnt->temp, automatic); }
 
+/*!\brief DS1825 conversion read profile setter
+** \param[in,out] pCpnt - Pointer to DS1825 peripheral
+** \param[in] profile - Conversion read profile
+** \param[in] maxDelta - Maximum temperature variation between reads (raw register units, 0 to disable variation check)
+**/
+__INLINE void NONNULL__ DS1825_Set_Read_Profile(DS1825_t * const pCpnt, const OW_temp_read_profile profile, const int16_t maxDelta) {
+	OW_TEMP_Set_Read_Profile(&pCpnt->temp, profile, maxDelta); }
+
 /*!\brief DS1825 start temperature conversion
 ** \param[in,out] pCpnt - Pointer to DS1825 peripheral
 ** \return FctERR - error code
@@ -173,6 +236,24 @@ __INLINE bool NONNULL__ DS1825_Get_New_Data(const DS1825_t * const pCpnt) {
 	return OW_TEMP_Get_New_Data(&pCpnt->temp); }
 
 
+/*!\brief DS1825 convert last temperature to centi Celsius degrees
+** \note Integer only computation (no floating point)
+** \param[in,out] pCpnt - Pointer to DS1825 peripheral
+** \return Temperature in centi Celsius degrees
+**/
+__INLINE int32_t NONNULL_INLINE__ DS1825_Get_Temperature_CentiCelsius(DS1825_t * const pCpnt) {
+	return OW_TEMP_Get_Temperature_CentiCelsius(&pCpnt->temp); }
+
+/*!\brief DS1825 convert last temperature to Q8.8 Celsius degrees
+** \note Integer only computation (no floating point)
+** \param[in,out] pCpnt - Pointer to DS1825 peripheral
+** \return Temperature in Celsius degrees (Q8.8 format)
+**/
+__INLINE int16_t NONNULL_INLINE__ DS1825_Get_Temperature_Q8(DS1825_t * const pCpnt) {
+	return OW_TEMP_Get_Temperature_Q8(&pCpnt->temp); }
+
+
+#if OW_TEMP_FLOAT_API
 /*!\brief DS1825 convert last temperature to Celsius degrees
 ** \param[in,out] pCpnt - Pointer to DS1825 peripheral
 ** \return Temperature in Celsius degrees
@@ -193,6 +274,7 @@ __INLINE float NONNULL_INLINE__ DS1825_Get_Temperature_Fahrenheit(DS1825_t * con
 **/
 __INLINE float NONNULL_INLINE__ DS1825_Get_Temperature_Kelvin(DS1825_t * const pCpnt) {
 	return OW_TEMP_Get_Temperature_Kelvin(&pCpnt->temp); }
+#endif
 
 
 /****************************************************************/
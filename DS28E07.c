@@ -14,16 +14,30 @@
 // std libs
 #include <string.h>
 /****************************************************************/
+#include "OW_eep_sched.h"
+/****************************************************************/
+
 
+#if OW_DEV_POOL
+/*!\struct DS28E07_inst_t
+** \brief DS28E07 pool instance
+**/
+typedef struct {
+	DS28E07_t	cpnt;	//!< DS28E07 User structure (first member: instance address is user structure address)
+	OW_slave_t	hal;	//!< DS28E07 Slave structure
+} DS28E07_inst_t;
 
+static OW_dev_pool_class_t DS28E07_pool = OW_DEV_POOL_CLASS(DS28E07_inst_t);	//!< DS28E07 instances pool class
+#else
 static OW_slave_t DS28E07_hal[OW_DS28E07_NB] = { 0 };					//!< DS28E07 Slave structure
 DS28E07_t DS28E07[OW_DS28E07_NB] = { 0 };								//!< DS28E07 User structure
+#endif
 
 static const OW_eep_props_t DS28E07_eep_props = {
 	DS28E07_SCRATCHPAD_SIZE, DS28E07_MEMORY_SIZE,
 	DS28E07_PAGE_SIZE, DS28E07_PAGES,
 	DS28E07_MAX_WRITE_ADDR, DS28E07_MAX_READ_ADDR,
-	DS28E07_COPY_TIME };												//!< DS28E07 eeprom parameters
+	DS28E07_COPY_TIME, false, NULL };									//!< DS28E07 eeprom parameters
 
 static const OW_ROM_type DS28E07_FAMILY_CODE = OW_TYPE__EEPROM_1024;	//!< DS28E07 family code
 
@@ -39,28 +53,92 @@ __WEAK FctERR NONNULL__ DS28E07_Init_Sequence(DS28E07_t * const pCpnt)
 	return DS28E07_Read_AdminData(pCpnt);
 }
 
-FctERR NONNULL__ DS28E07_Init(const uint8_t idx, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
+/*!\brief DS28E07 peripheral instance initialization
+** \param[in,out] pCpnt - Pointer to DS28E07 peripheral
+** \param[in,out] pSlave - Pointer to DS28E07 slave structure
+** \param[in] pOW - pointer to OneWire driver instance
+** \param[in] pROM - Pointer to ROM Id structure
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ DS28E07_Init_Instance(DS28E07_t * const pCpnt, OW_slave_t * const pSlave, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
 {
 	FctERR err = ERROR_DEVICE_UNKNOWN;
 
-	assert_param(IS_OW_PERIPHERAL(DS28E07, idx));
-
 	if (pROM->familyCode == DS28E07_FAMILY_CODE)	// Family code matches
 	{
-		OW_slave_init(&DS28E07_hal[idx], pOW, pROM);
-		OW_SN_SET_DEFAULTS(DS28E07, idx, pROM);
-		OW_EEPROM_SET_DEFAULTS(DS28E07, idx);
+		err = OW_slave_init(pSlave, pOW, pROM);
+
+		if (err == ERROR_OK)
+		{
+			OW_SN_SET_DEFAULTS(pCpnt, pSlave, pROM);
+			OW_EEPROM_SET_DEFAULTS(DS28E07, pCpnt, pSlave);
 
-		err = DS28E07_Init_Sequence(&DS28E07[idx]);
+			err = DS28E07_Init_Sequence(pCpnt);
+		}
 	}
 
-	if (err != ERROR_OK)	{ OW_set_enable(&DS28E07_hal[idx], false); }
+	if (err != ERROR_OK)	{ OW_set_enable(pSlave, false); }
 
 	return err;
 }
 
+#if OW_DEV_POOL
+FctERR NONNULL__ DS28E07_New(OW_DRV * const pOW, const OW_ROM_ID_t * const pROM, DS28E07_t ** const ppCpnt)
+{
+	DS28E07_inst_t *	pInst;
+	FctERR				err = ERROR_OK;
+
+	*ppCpnt = NULL;
+
+	if (pROM->familyCode != DS28E07_FAMILY_CODE)	{ err = ERROR_DEVICE_UNKNOWN; }	// Declined without allocation
+	if (err != ERROR_OK)							{ goto ret; }
+
+	pInst = (DS28E07_inst_t *) OW_Dev_Pool_Alloc(&DS28E07_pool);
+
+	if (pInst == NULL)	{ err = ERROR_MEMORY; }
+	else
+	{
+		err = DS28E07_Init_Instance(&pInst->cpnt, &pInst->hal, pOW, pROM);
+
+		if (err == ERROR_OK)	{ *ppCpnt = &pInst->cpnt; }
+		else
+		{
+			OW_slave_deinit(&pInst->hal);
+			OW_Dev_Pool_Free(&DS28E07_pool, pInst);
+		}
+	}
+
+	ret:
+	return err;
+}
+
+FctERR NONNULL__ DS28E07_Delete(DS28E07_t * const pCpnt)
+{
+	DS28E07_inst_t * const	pInst = (DS28E07_inst_t *) pCpnt;	// User structure is first member of pool instance
+	FctERR					err = ERROR_OK;
+
+	if (OW_is_busy(&pInst->hal))								{ err = ERROR_BUSY; }	// Transaction ongoing on device
+	if (pCpnt->eep.job.ongoing || pCpnt->eep.stream.ongoing)	{ err = ERROR_BUSY; }	// Write job or streaming read ongoing
+	if (err == ERROR_OK)										{ err = OW_EEP_Sched_Remove(&pCpnt->eep); }
+	if (err != ERROR_OK)										{ goto ret; }
+
+	OW_slave_deinit(&pInst->hal);
+	OW_Dev_Pool_Free(&DS28E07_pool, pInst);
+
+	ret:
+	return err;
+}
+#else
+FctERR NONNULL__ DS28E07_Init(const uint8_t idx, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
+{
+	assert_param(IS_OW_PERIPHERAL(DS28E07, idx));
+
+	return DS28E07_Init_Instance(&DS28E07[idx], &DS28E07_hal[idx], pOW, pROM);
+}
+
 FctERR DS28E07_Init_Single(const OW_ROM_ID_t * const pROM) {
 	return DS28E07_Init(0U, OW_DS28E07, pROM); }
+#endif
 
 
 
@@ -16,6 +16,7 @@
 #include "sarmfsw.h"
 
 #include "OW_component.h"
+#include "OW_dev_pool.h"
 #include "OW_dev_sn.h"
 #include "OW_dev_eeprom.h"
 /****************************************************************/
@@ -23,7 +24,7 @@
 
 #ifndef OW_DS28E07_NB
 //! \note Define OW_DS28E07_NB_NB to enable multiple peripherals of this type
-#define OW_DS28E07_NB	1U	//!< Number of DS28E07 peripherals
+#define OW_DS28E07_NB	1U	//!< Number of DS28E07 peripherals (static instances, unused with OW_DEV_POOL)
 #endif
 
 
@@ -143,6 +144,10 @@ typedef struct {
 	/*** device specific variables ***/
 	OW_eep_scratch_t			scratch;								//!< Scratchpad structure
 	uint8_t						scratch_data[DS28E07_SCRATCHPAD_SIZE];	//!< Scratchpad data array
+#if OW_EEP_CACHE
+	uint8_t						cache_data[DS28E07_MEMORY_SIZE];								//!< Shadow cache memory image
+	uint8_t						cache_state[DS28E07_MEMORY_SIZE / DS28E07_SCRATCHPAD_SIZE];	//!< Shadow cache rows state
+#endif
 	union PACK__ {
 		uint8_t					admin_data[8];	//!< Administrative data array
 		struct PACK__ {
@@ -157,7 +162,9 @@ typedef struct {
 	} admin;
 } DS28E07_t;
 
+#if !OW_DEV_POOL
 extern DS28E07_t DS28E07[OW_DS28E07_NB];	//!< DS28E07 User structure
+#endif
 
 
 // *****************************************************************************
@@ -186,6 +193,25 @@ __INLINE uint64_t NONNULL_INLINE__ DS28E07_Get_SN(DS28E07_t * const pCpnt) {
 **/
 FctERR NONNULL__ DS28E07_Init_Sequence(DS28E07_t * const pCpnt);
 
+#if OW_DEV_POOL
+/*!\brief DS28E07 peripheral instance creation (allocated from device pool & initialized)
+** \param[in] pOW - pointer to OneWire driver instance
+** \param[in] pROM - Pointer to ROM Id structure
+** \param[out] ppCpnt - Pointer to created DS28E07 peripheral pointer (NULL on failure)
+** \return FctERR - error code
+** \retval ERROR_DEVICE_UNKNOWN - ROM Id family code not matching (nothing allocated)
+** \retval ERROR_MEMORY - Device pool exhausted
+**/
+FctERR NONNULL__ DS28E07_New(OW_DRV * const pOW, const OW_ROM_ID_t * const pROM, DS28E07_t ** const ppCpnt);
+
+/*!\brief DS28E07 peripheral instance deletion (removed device)
+** \note Instance is removed from EEPROM scheduler, slave lock identifier is released & instance is returned to device pool
+** \param[in,out] pCpnt - Pointer to DS28E07 peripheral (created with \ref DS28E07_New)
+** \return FctERR - error code
+** \retval ERROR_BUSY - Device transaction, write job or streaming read ongoing, instance kept (to be called again later)
+**/
+FctERR NONNULL__ DS28E07_Delete(DS28E07_t * const pCpnt);
+#else
 /*!\brief Initialization for DS28E07 peripheral
 ** \param[in] idx - DS28E07 index
 ** \param[in] pOW - pointer to OneWire driver instance
@@ -200,6 +226,7 @@ FctERR NONNULL__ DS28E07_Init(const uint8_t idx, OW_DRV * const pOW, const OW_RO
 ** \return FctERR - error code
 **/
 FctERR DS28E07_Init_Single(const OW_ROM_ID_t * const pROM);
+#endif
 
 
 /*************************************/
@@ -216,6 +243,14 @@ __INLINE FctERR NONNULL_INLINE__ DS28E07_WriteCycle_Handler(DS28E07_t * const pC
 	return OW_EEP_WriteCycle_Handler(&pCpnt->eep); }
 
 
+/*!\brief DS28E07 last observed programming time getter
+** \note Programming time is only observed on devices declared externally powered (maximum copy time otherwise)
+** \param[in] pCpnt - Pointer to DS28E07 component
+** \return Last observed programming time (in ms)
+**/
+__INLINE uint8_t NONNULL_INLINE__ DS28E07_Get_Prog_Time(const DS28E07_t * const pCpnt) {
+	return OW_EEP_Get_Prog_Time(&pCpnt->eep); }
+
 /*!\brief DS28E07 read from memory
 ** \param[in,out] pCpnt - Pointer to DS28E07 component
 ** \param[in,out] pData - Pointer to data for reception
@@ -226,6 +261,20 @@ __INLINE FctERR NONNULL_INLINE__ DS28E07_WriteCycle_Handler(DS28E07_t * const pC
 __INLINE FctERR NONNULL_INLINE__ DS28E07_Read_Memory(DS28E07_t * const pCpnt, uint8_t * pData, const uint32_t addr, const size_t len) {
 	return OW_EEP_Read_Memory(&pCpnt->eep, pData, addr, len); }
 
+/*!\brief DS28E07 streaming read (single read memory command, data delivered chunk by chunk)
+** \param[in,out] pCpnt - Pointer to DS28E07 component
+** \param[in] addr - Memory cell start address
+** \param[in] len - Number of data bytes to read
+** \param[in,out] pBuf - Pointer to bounce buffer
+** \param[in] chunk_size - Chunk size (bounce buffer size)
+** \param[in] pfChunk - Chunk delivery function pointer
+** \param[in] pCtx - Chunk delivery user context (may be NULL)
+** \return FctERR - error code
+**/
+__INLINE FctERR NONNULLX__(1, 4, 6) DS28E07_Read_Stream(DS28E07_t * const pCpnt, const uint32_t addr, const size_t len,
+												uint8_t * pBuf, const size_t chunk_size, const pfOW_eepStreamChunk_t pfChunk, void * const pCtx) {
+	return OW_EEP_Read_Stream(&pCpnt->eep, addr, len, pBuf, chunk_size, pfChunk, pCtx); }
+
 /*!\brief DS28E07 write to memory
 ** \param[in,out] pCpnt - Pointer to DS28E07 component
 ** \param[in] pData - Pointer to data for transmission
@@ -236,6 +285,77 @@ __INLINE FctERR NONNULL_INLINE__ DS28E07_Read_Memory(DS28E07_t * const pCpnt, ui
 __INLINE FctERR NONNULL_INLINE__ DS28E07_Write_Memory(DS28E07_t * const pCpnt, const uint8_t * pData, const uint32_t addr, const size_t len) {
 	return OW_EEP_Write_Memory(&pCpnt->eep, pData, addr, len); }
 
+#if OW_EEP_CACHE
+/*!\brief DS28E07 read through shadow cache
+** \param[in,out] pCpnt - Pointer to DS28E07 component
+** \param[in,out] pData - Pointer to data for reception
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to receive
+** \return FctERR - error code
+**/
+__INLINE FctERR NONNULL_INLINE__ DS28E07_Cache_Read(DS28E07_t * const pCpnt, uint8_t * pData, const uint32_t addr, const size_t len) {
+	return OW_EEP_Cache_Read(&pCpnt->eep, pData, addr, len); }
+
+/*!\brief DS28E07 write to shadow cache
+** \param[in,out] pCpnt - Pointer to DS28E07 component
+** \param[in] pData - Pointer to data for transmission
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to transmit
+** \return FctERR - error code
+**/
+__INLINE FctERR NONNULL_INLINE__ DS28E07_Cache_Write(DS28E07_t * const pCpnt, const uint8_t * pData, const uint32_t addr, const size_t len) {
+	return OW_EEP_Cache_Write(&pCpnt->eep, pData, addr, len); }
+
+/*!\brief DS28E07 shadow cache write back (blocking)
+** \param[in,out] pCpnt - Pointer to DS28E07 component
+** \return FctERR - error code
+**/
+__INLINE FctERR NONNULL_INLINE__ DS28E07_Cache_Flush(DS28E07_t * const pCpnt) {
+	return OW_EEP_Cache_Flush(&pCpnt->eep); }
+#endif
+
+/*!\brief DS28E07 write verification level setter
+** \param[in,out] pCpnt - Pointer to DS28E07 component
+** \param[in] level - Write verification level
+**/
+__INLINE void NONNULL_INLINE__ DS28E07_Set_Verify(DS28E07_t * const pCpnt, const OW_eep_verify level) {
+	OW_EEP_Set_Verify(&pCpnt->eep, level); }
+
+/*!\brief DS28E07 differential writes setter
+** \note When enabled, only rows with changed content are written
+** \param[in,out] pCpnt - Pointer to DS28E07 component
+** \param[in] en - Differential writes enable flag
+**/
+__INLINE void NONNULL_INLINE__ DS28E07_Set_Diff_Write(DS28E07_t * const pCpnt, const bool en) {
+	OW_EEP_Set_Diff_Write(&pCpnt->eep, en); }
+
+/*!\brief DS28E07 differential writes skipped rows getter
+** \param[in] pCpnt - Pointer to DS28E07 component
+** \return Number of rows left untouched by differential writes
+**/
+__INLINE uint32_t NONNULL_INLINE__ DS28E07_Get_Skipped_Rows(const DS28E07_t * const pCpnt) {
+	return OW_EEP_Get_Skipped_Rows(&pCpnt->eep); }
+
+/*!\brief DS28E07 asynchronous write to memory
+** \note Job is handled row by row by \ref DS28E07_Write_Memory_Handler calls, completion is reported by \ref OW_EEP_Write_Memory_Done_Callback
+** \warning Data buffer shall remain valid until job completion
+** \param[in,out] pCpnt - Pointer to DS28E07 component
+** \param[in] pData - Pointer to data for transmission
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to transmit
+** \return FctERR - error code
+**/
+__INLINE FctERR NONNULL_INLINE__ DS28E07_Write_Memory_Async(DS28E07_t * const pCpnt, const uint8_t * pData, const uint32_t addr, const size_t len) {
+	return OW_EEP_Write_Memory_Async(&pCpnt->eep, pData, addr, len); }
+
+/*!\brief DS28E07 asynchronous write job handler
+** \note Handler shall be called periodically in a main like loop or from a timer
+** \param[in,out] pCpnt - Pointer to DS28E07 component
+** \return FctERR - error code (ERROR_BUSY while job is ongoing)
+**/
+__INLINE FctERR NONNULL_INLINE__ DS28E07_Write_Memory_Handler(DS28E07_t * const pCpnt) {
+	return OW_EEP_Write_Memory_Handler(&pCpnt->eep); }
+
 
 /*!\brief DS28E07 read scratchpad
 ** \param[in,out] pCpnt - Pointer to DS28E07 component
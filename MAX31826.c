@@ -13,22 +13,47 @@
 // std libs
 #include <string.h>
 /****************************************************************/
+#include "OW_temp_pipeline.h"
+#include "OW_temp_alarm.h"
+#include "OW_eep_sched.h"
+/****************************************************************/
+
 
+#if OW_DEV_POOL
+/*!\struct MAX31826_inst_t
+** \brief MAX31826 pool instance
+**/
+typedef struct {
+	MAX31826_t	cpnt;	//!< MAX31826 User structure (first member: instance address is user structure address)
+	OW_slave_t	hal;	//!< MAX31826 Slave structure
+} MAX31826_inst_t;
 
+static OW_dev_pool_class_t MAX31826_pool = OW_DEV_POOL_CLASS(MAX31826_inst_t);	//!< MAX31826 instances pool class
+#else
 static OW_slave_t MAX31826_hal[OW_MAX31826_NB] = { 0 };								//!< MAX31826 Slave structure
 MAX31826_t MAX31826[OW_MAX31826_NB] = { 0 };										//!< MAX31826 User structure
+#endif
 
 static const uint16_t MAX31826_convTimes[] = { 150 };								//!< MAX31826 conversion times (in ms)
 
 static const OW_temp_props_t MAX31826_temp_props = {
 	MAX31826_convTimes, OW_TEMP__RES_12BIT, OW_TEMP__RES_12BIT,
-	MAX31826__GRANULARITY, 0 };														//!< MAX31826 temperature sensor parameters
+	MAX31826__GRANULARITY, 0, MAX31826__FRAC_BITS };								//!< MAX31826 temperature sensor parameters
+
+__STATIC FctERR NONNULL__ MAX31826_EEP_Read_Scratchpad(OW_eep_t * const pEEP);
+__STATIC FctERR NONNULL__ MAX31826_EEP_Write_Scratchpad(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len);
+__STATIC FctERR NONNULL__ MAX31826_EEP_Copy_Scratchpad(OW_eep_t * const pEEP);
+__STATIC FctERR NONNULL__ MAX31826_EEP_Read_Memory(OW_eep_t * const pEEP, uint8_t * pData, const uint32_t addr, const size_t len);
+
+static const OW_eep_ops_t MAX31826_eep_ops = {
+	MAX31826_EEP_Read_Scratchpad, MAX31826_EEP_Write_Scratchpad,
+	MAX31826_EEP_Copy_Scratchpad, MAX31826_EEP_Read_Memory };						//!< MAX31826 eeprom specific operations (1 byte address, CRC8)
 
 static const OW_eep_props_t MAX31826_eep_props = {
 	MAX31826_SCRATCHPAD_SIZE, MAX31826_MEMORY_SIZE,
 	MAX31826_PAGE_SIZE, MAX31826_PAGES,
 	MAX31826_MAX_WRITE_ADDR, MAX31826_MAX_READ_ADDR,
-	MAX31826_COPY_TIME };															//!< MAX31826 eeprom parameters
+	MAX31826_COPY_TIME, false, &MAX31826_eep_ops };										//!< MAX31826 eeprom parameters
 
 static const OW_ROM_type MAX31826_FAMILY_CODE = OW_TYPE__THERMOMETER__EEPROM_1K;	//!< MAX31826 family code
 
@@ -72,29 +97,95 @@ __WEAK FctERR NONNULL__ MAX31826_Init_Sequence(MAX31826_t * const pCpnt)
 	return err;
 }
 
-FctERR NONNULL__ MAX31826_Init(const uint8_t idx, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
+/*!\brief MAX31826 peripheral instance initialization
+** \param[in,out] pCpnt - Pointer to MAX31826 peripheral
+** \param[in,out] pSlave - Pointer to MAX31826 slave structure
+** \param[in] pOW - pointer to OneWire driver instance
+** \param[in] pROM - Pointer to ROM Id structure
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ MAX31826_Init_Instance(MAX31826_t * const pCpnt, OW_slave_t * const pSlave, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
 {
 	FctERR err = ERROR_DEVICE_UNKNOWN;
 
-	assert_param(IS_OW_PERIPHERAL(MAX31826, idx));
-
 	if (pROM->familyCode == MAX31826_FAMILY_CODE)	// Family code matches
 	{
-		OW_slave_init(&MAX31826_hal[idx], pOW, pROM);
-		OW_SN_SET_DEFAULTS(MAX31826, idx, pROM);
-		OW_TEMP_SET_DEFAULTS(MAX31826, idx);
-		OW_EEPROM_SET_DEFAULTS(MAX31826, idx);
+		err = OW_slave_init(pSlave, pOW, pROM);
+
+		if (err == ERROR_OK)
+		{
+			OW_SN_SET_DEFAULTS(pCpnt, pSlave, pROM);
+			OW_TEMP_SET_DEFAULTS(MAX31826, pCpnt, pSlave);
+			OW_EEPROM_SET_DEFAULTS(MAX31826, pCpnt, pSlave);
+
+			err = MAX31826_Init_Sequence(pCpnt);
+		}
+	}
+
+	if (err != ERROR_OK)	{ OW_set_enable(pSlave, false); }
+
+	return err;
+}
+
+#if OW_DEV_POOL
+FctERR NONNULL__ MAX31826_New(OW_DRV * const pOW, const OW_ROM_ID_t * const pROM, MAX31826_t ** const ppCpnt)
+{
+	MAX31826_inst_t *	pInst;
+	FctERR				err = ERROR_OK;
+
+	*ppCpnt = NULL;
+
+	if (pROM->familyCode != MAX31826_FAMILY_CODE)	{ err = ERROR_DEVICE_UNKNOWN; }	// Declined without allocation
+	if (err != ERROR_OK)							{ goto ret; }
+
+	pInst = (MAX31826_inst_t *) OW_Dev_Pool_Alloc(&MAX31826_pool);
+
+	if (pInst == NULL)	{ err = ERROR_MEMORY; }
+	else
+	{
+		err = MAX31826_Init_Instance(&pInst->cpnt, &pInst->hal, pOW, pROM);
 
-		err = MAX31826_Init_Sequence(&MAX31826[idx]);
+		if (err == ERROR_OK)	{ *ppCpnt = &pInst->cpnt; }
+		else
+		{
+			OW_slave_deinit(&pInst->hal);
+			OW_Dev_Pool_Free(&MAX31826_pool, pInst);
+		}
 	}
 
-	if (err != ERROR_OK)	{ OW_set_enable(&MAX31826_hal[idx], false); }
+	ret:
+	return err;
+}
+
+FctERR NONNULL__ MAX31826_Delete(MAX31826_t * const pCpnt)
+{
+	MAX31826_inst_t * const	pInst = (MAX31826_inst_t *) pCpnt;	// User structure is first member of pool instance
+	FctERR					err = ERROR_OK;
+
+	if (OW_is_busy(&pInst->hal))								{ err = ERROR_BUSY; }	// Transaction ongoing on device
+	if (pCpnt->eep.job.ongoing || pCpnt->eep.stream.ongoing)	{ err = ERROR_BUSY; }	// Write job or streaming read ongoing
+	if (err == ERROR_OK)										{ err = OW_TEMP_Pipeline_Unregister(&pCpnt->temp); }
+	if (err == ERROR_OK)										{ err = OW_TEMP_Alarm_Unregister(&pCpnt->temp); }
+	if (err == ERROR_OK)										{ err = OW_EEP_Sched_Remove(&pCpnt->eep); }
+	if (err != ERROR_OK)										{ goto ret; }
+
+	OW_slave_deinit(&pInst->hal);
+	OW_Dev_Pool_Free(&MAX31826_pool, pInst);
 
+	ret:
 	return err;
 }
+#else
+FctERR NONNULL__ MAX31826_Init(const uint8_t idx, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
+{
+	assert_param(IS_OW_PERIPHERAL(MAX31826, idx));
+
+	return MAX31826_Init_Instance(&MAX31826[idx], &MAX31826_hal[idx], pOW, pROM);
+}
 
 FctERR MAX31826_Init_Single(const OW_ROM_ID_t * const pROM) {
 	return MAX31826_Init(0, OW_MAX31826, pROM); }
+#endif
 
 
 /****************************************************************/
@@ -110,20 +201,25 @@ __STATIC FctERR NONNULL__ MAX31826_EEP_Copy_Scratchpad(OW_eep_t * const pEEP)
 
 	OW_set_busy(pSlave, true);
 
+	// Not retried: copy could have started at first attempt
 	FctERR err = OWROMCmd_Control_Sequence(pSlave->cfg.bus_inst, &pSlave->cfg.ROM_ID, false);
+
+	if (err == ERROR_OK)
+	{
+		const uint8_t cmd[2] = { OW_EEP__COPY_SCRATCHPAD, 0xA5U };
+		err = OWWrite(pSlave->cfg.bus_inst, cmd, sizeof(cmd));
+	}
+
 	if (err != ERROR_OK)
 	{
 		OW_set_busy(pSlave, false);
 		goto ret;
 	}
 
-	const uint8_t cmd[2] = { OW_EEP__COPY_SCRATCHPAD, 0xA5U };
-	UNUSED_RET OWWrite(pSlave->cfg.bus_inst, cmd, sizeof(cmd));
-
 	pEEP->hStartWrite = HALTicks();
 	pEEP->doneWrite = false;
 
-	OW_StrongPull_Set(pEEP->slave_inst->cfg.bus_inst, true);
+	if (OW_EEP_Copy_Strong_Pull(pEEP))	{ OW_StrongPull_Set(pEEP->slave_inst->cfg.bus_inst, true); }
 
 	// Do not release slave at this stage, copy to eeprom is ongoing
 
@@ -141,6 +237,7 @@ __STATIC FctERR NONNULL__ MAX31826_EEP_Read_Scratchpad(OW_eep_t * const pEEP)
 	OW_slave_t * const		pSlave = pEEP->slave_inst;
 	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
 	uint8_t					crc;
+	uint8_t					attempt = 0U;
 	FctERR					err = ERROR_OK;
 
 	if (!OW_is_enabled(pSlave))		{ err = ERROR_DISABLED; }	// Peripheral disabled
@@ -149,24 +246,34 @@ __STATIC FctERR NONNULL__ MAX31826_EEP_Read_Scratchpad(OW_eep_t * const pEEP)
 
 	OW_set_busy(pSlave, true);
 
-	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)	{ goto err; }
-
 	const uint8_t cmd[2] = { OW_EEP__READ_SCRATCHPAD, LOBYTE(pEEP->scratch.address) };
-	UNUSED_RET OWWrite(pDrv, cmd, sizeof(cmd));
 
-	UNUSED_RET OWRead(pDrv, pEEP->scratch.pData, pEEP->props->scratchpad_size);
-	UNUSED_RET OWRead(pDrv, &crc, sizeof(crc));
+	do
+	{
+		uint8_t crc8 = 0U;
 
-	pEEP->scratch.crc = crc;
+		OWCompute_DallasCRC8(&crc8, cmd, sizeof(cmd));
 
-	crc = 0U;
-	OWCompute_DallasCRC8(&crc, cmd, sizeof(cmd));
-	OWCompute_DallasCRC8(&crc, pEEP->scratch.pData, pEEP->props->scratchpad_size);
+		// CRC8 accumulated while receiving data
+		err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+		if (err == ERROR_OK)	{ err = OWWrite(pDrv, cmd, sizeof(cmd)); }
+		if (err == ERROR_OK)	{ err = OWRead_CRC8(pDrv, pEEP->scratch.pData, pEEP->props->scratchpad_size, &crc8); }
+		if (err == ERROR_OK)	{ err = OWRead(pDrv, &crc, sizeof(crc)); }
 
-	if (crc != pEEP->scratch.crc) { err = ERROR_CRC; }
+		if (err == ERROR_OK)
+		{
+			pEEP->scratch.crc = crc;
+
+			if (crc8 != pEEP->scratch.crc)
+			{
+				err = ERROR_CRC;
+				OW_STATS_INC(pDrv, crcEEP);
+				OW_TRACE(pDrv, OW_TRACE__CRC, OW_TRACE_CRC__EEP, 0U);
+			}
+		}
+	}
+	while (OW_Retry_Check(pDrv, err, &attempt));
 
-	err:
 	OW_set_busy(pSlave, false);
 
 	ret:
@@ -185,6 +292,7 @@ __STATIC FctERR NONNULL__ MAX31826_EEP_Write_Scratchpad(OW_eep_t * const pEEP, c
 {
 	OW_slave_t * const		pSlave = pEEP->slave_inst;
 	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
+	uint8_t					attempt = 0U;
 	FctERR					err = ERROR_OK;
 
 	//if (!OW_is_enabled(pSlave))			{ err = ERROR_DISABLED; }	// Peripheral disabled
@@ -192,7 +300,7 @@ __STATIC FctERR NONNULL__ MAX31826_EEP_Write_Scratchpad(OW_eep_t * const pEEP, c
 	if (len > pEEP->props->scratchpad_size)	{ err = ERROR_OVERFLOW; }	// Scratchpad overflow
 	if (err != ERROR_OK)					{ goto ret; }
 
-	// TODO: is this really needed? (for now, scratchpad is always read back after writing), still needs to be set if no read back is done (for copy)
+	// Needed for scratchpad read back
 	pEEP->scratch.address = addr;
 	pEEP->scratch.nb = len;
 
@@ -206,43 +314,43 @@ __STATIC FctERR NONNULL__ MAX31826_EEP_Write_Scratchpad(OW_eep_t * const pEEP, c
 
 	OW_set_busy(pSlave, true);
 
-	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)
+	do
 	{
-		OW_set_busy(pSlave, false);
-		goto ret;
-	}
+		uint8_t CRC_received = 0;
 
-	UNUSED_RET OWWrite(pDrv, cmd, sizeof(cmd));
-	UNUSED_RET OWWrite(pDrv, pEEP->scratch.pData, len);
+		err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+		if (err == ERROR_OK)	{ err = OWWrite(pDrv, cmd, sizeof(cmd)); }
+		if (err == ERROR_OK)	{ err = OWWrite(pDrv, pEEP->scratch.pData, len); }
+		if (err == ERROR_OK)	{ err = OWRead(pDrv, &CRC_received, sizeof(CRC_received)); }	// Get Byte to verify CRC
 
-	// Get Byte to verify CRC
-	uint8_t CRC_received = 0;
-	UNUSED_RET OWRead(pDrv, &CRC_received, sizeof(CRC_received));
+		if ((err == ERROR_OK) && (CRC_data != CRC_received))
+		{
+			err = ERROR_CRC;
+			OW_STATS_INC(pDrv, crcEEP);
+			OW_TRACE(pDrv, OW_TRACE__CRC, OW_TRACE_CRC__EEP, 0U);
+		}
+	}
+	while (OW_Retry_Check(pDrv, err, &attempt));
 
 	OW_set_busy(pSlave, false);
 
-	if (CRC_data != CRC_received) { err = ERROR_CRC; }
-	else
-	{
-		err = MAX31826_EEP_Read_Scratchpad(pEEP);
-
-		// TODO: check data & iCRC ?
-
-		// If further operations done on bus, set busy again
-		//OW_set_busy(pSlave, true);
-	}
-
 	ret:
 	return err;
 }
 
 
-FctERR NONNULL__ MAX31826_Read_Memory(MAX31826_t * const pCpnt, uint8_t * pData, const uint32_t addr, const size_t len)
+/*!\brief MAX31826 read from memory
+** \param[in,out] pEEP - Pointer to MAX31826 EEP component
+** \param[in,out] pData - Pointer to data for reception
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to receive
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ MAX31826_EEP_Read_Memory(OW_eep_t * const pEEP, uint8_t * pData, const uint32_t addr, const size_t len)
 {
-	OW_eep_t * const		pEEP = &pCpnt->eep;
 	OW_slave_t * const		pSlave = pEEP->slave_inst;
 	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
+	uint8_t					attempt = 0U;
 	FctERR					err = ERROR_OK;
 
 	if (!OW_is_enabled(pSlave))									{ err = ERROR_DISABLED; }	// Peripheral disabled
@@ -253,14 +361,16 @@ FctERR NONNULL__ MAX31826_Read_Memory(MAX31826_t * const pCpnt, uint8_t * pData,
 
 	OW_set_busy(pSlave, true);
 
-	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)	{ goto err; }
-
 	const uint8_t cmd[2] = { OW_EEP__READ_MEMORY, LOBYTE(addr) };
-	UNUSED_RET OWWrite(pDrv, cmd, sizeof(cmd));
-	UNUSED_RET OWRead(pDrv, pData, len);
 
-	err:
+	do
+	{
+		err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+		if (err == ERROR_OK)	{ err = OWWrite(pDrv, cmd, sizeof(cmd)); }
+		if (err == ERROR_OK)	{ err = OWRead(pDrv, pData, len); }
+	}
+	while (OW_Retry_Check(pDrv, err, &attempt));
+
 	OW_set_busy(pSlave, false);
 
 	ret:
@@ -268,70 +378,12 @@ FctERR NONNULL__ MAX31826_Read_Memory(MAX31826_t * const pCpnt, uint8_t * pData,
 }
 
 
-FctERR NONNULL__ MAX31826_Write_Memory(MAX31826_t * const pCpnt, const uint8_t * pData, const uint32_t addr, const size_t len)
-{
-	OW_eep_t * const			pEEP = &pCpnt->eep;
-	const OW_slave_t * const	pSlave = pEEP->slave_inst;
-	FctERR						err = ERROR_OK;
-
-	if (!OW_is_enabled(pSlave))									{ err = ERROR_DISABLED; }	// Peripheral disabled
-	if (OW_is_busy(pSlave))										{ err = ERROR_BUSY; }		// Device busy
-	if (addr > pEEP->props->max_write_address)					{ err = ERROR_RANGE; }		// Unknown address
-	if ((addr + len) > (pEEP->props->max_write_address + 1U))	{ err = ERROR_OVERFLOW; }	// Bank overflow
-	if (err != ERROR_OK)										{ goto ret; }
-
-	size_t		data_len = len;
-	size_t		unaligned_len = addr % pEEP->props->scratchpad_size;
-	uint32_t	address = addr - unaligned_len;	// If unaligned write access, adjust address to read aligned bytes first
-
-	while (data_len != 0U)
-	{
-		while (MAX31826_WriteCycle_Handler(pCpnt) != ERROR_OK)	// Wait for a previous write to complete
-		{
-			OW_Watchdog_Refresh();
-			HAL_Delay(1U);
-		}
-
-		const size_t write_len = min(pEEP->props->scratchpad_size - unaligned_len, data_len);
-
-		if (unaligned_len != 0U)
-		{
-			const size_t read_len = ((write_len + unaligned_len) == pEEP->props->scratchpad_size) ? unaligned_len : pEEP->props->scratchpad_size;
-
-			err = MAX31826_Read_Memory(pCpnt, pEEP->scratch.pData, address, read_len);
-			UNUSED_RET memcpy(&pEEP->scratch.pData[unaligned_len], pData, write_len);
-			unaligned_len = 0U;	// Reset unaligned_len, further writes will be aligned
-		}
-		else if (write_len < pEEP->props->scratchpad_size)
-		{
-			const size_t read_len = pEEP->props->scratchpad_size - write_len;
-
-			err = MAX31826_Read_Memory(pCpnt, &pEEP->scratch.pData[write_len], address + write_len, read_len);
-			UNUSED_RET memcpy(pEEP->scratch.pData, pData, write_len);
-		}
-		else
-		{
-			UNUSED_RET memcpy(pEEP->scratch.pData, pData, pEEP->props->scratchpad_size);
-		}
-
-		if (err != ERROR_OK)	{ goto ret; }
-
-		// Write scratchpad & Check CRC16 or Read scratchpad to see if matching with written values
-		err = MAX31826_EEP_Write_Scratchpad(pEEP, pEEP->scratch.pData, address, pEEP->props->scratchpad_size);
-		if (err != ERROR_OK)	{ goto ret; }
-
-		// Copy scratchpad
-		err = MAX31826_EEP_Copy_Scratchpad(pEEP);
-		if (err != ERROR_OK)	{ goto ret; }
+FctERR NONNULL__ MAX31826_Read_Memory(MAX31826_t * const pCpnt, uint8_t * pData, const uint32_t addr, const size_t len) {
+	return MAX31826_EEP_Read_Memory(&pCpnt->eep, pData, addr, len); }
 
-		pData += write_len;
-		data_len -= write_len;
-		address += pEEP->props->scratchpad_size;
-	}
 
-	ret:
-	return err;
-}
+FctERR NONNULL__ MAX31826_Write_Memory(MAX31826_t * const pCpnt, const uint8_t * pData, const uint32_t addr, const size_t len) {
+	return OW_EEP_Write_Memory(&pCpnt->eep, pData, addr, len); }
 
 
 /****************************************************************/
@@ -349,12 +401,13 @@ FctERR NONNULL__ MAX31826_Lock_Memory(MAX31826_t * const pCpnt, const MAX31826_e
 	OW_set_busy(pSlave, true);
 
 	err = OWROMCmd_Control_Sequence(pSlave->cfg.bus_inst, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)	{ goto err; }
 
-	const uint8_t cmd[2] = { (area == MAX31826__EEP_LOW) ? MAX31826__LOCK_EEP_LOW : MAX31826__LOCK_EEP_HIGH, 0x55U };
-	UNUSED_RET OWWrite(pSlave->cfg.bus_inst, cmd, sizeof(cmd));
+	if (err == ERROR_OK)
+	{
+		const uint8_t cmd[2] = { (area == MAX31826__EEP_LOW) ? MAX31826__LOCK_EEP_LOW : MAX31826__LOCK_EEP_HIGH, 0x55U };
+		err = OWWrite(pSlave->cfg.bus_inst, cmd, sizeof(cmd));
+	}
 
-	err:
 	OW_set_busy(pSlave, false);
 
 	ret:
@@ -15,6 +15,7 @@
 #include "sarmfsw.h"
 
 #include "OW_component.h"
+#include "OW_dev_pool.h"
 #include "OW_dev_sn.h"
 #include "OW_dev_temp.h"
 #include "OW_dev_eeprom.h"
@@ -23,7 +24,7 @@
 
 #ifndef OW_MAX31826_NB
 //! \note Define OW_MAX31826_NB_NB to enable multiple peripherals of this type
-#define OW_MAX31826_NB	1U	//!< Number of MAX31826 peripherals
+#define OW_MAX31826_NB	1U	//!< Number of MAX31826 peripherals (static instances, unused with OW_DEV_POOL)
 #endif
 
 
@@ -31,6 +32,7 @@
 // Section: Constants
 // *****************************************************************************
 #define MAX31826__GRANULARITY		0.0625f		//!< MAX31826 temperature sensor granularity
+#define MAX31826__FRAC_BITS		4U			//!< MAX31826 temperature register fractional bits (granularity = 2^-4)
 
 #define MAX31826_PAGES				16U										//!< MAX31826 Number of Pages
 #define MAX31826_PAGE_SIZE			8U										//!< MAX31826 Page Size
@@ -116,10 +118,16 @@ typedef struct {
 	OW_eep_t	eep;		//!< EEPROM device type structure
 	/*** device specific variables ***/
 	uint8_t		scratch_data[MAX31826_SCRATCHPAD_SIZE];	//!< Scratchpad data array (EEPROM)
+#if OW_EEP_CACHE
+	uint8_t		cache_data[MAX31826_MEMORY_SIZE];								//!< Shadow cache memory image (EEPROM)
+	uint8_t		cache_state[MAX31826_MEMORY_SIZE / MAX31826_SCRATCHPAD_SIZE];	//!< Shadow cache rows state (EEPROM)
+#endif
 	uint8_t		location;	//!< Device location (defined by hardware pin coding)
 } MAX31826_t;
 
+#if !OW_DEV_POOL
 extern MAX31826_t MAX31826[OW_MAX31826_NB];	//!< MAX31826 User structure
+#endif
 
 
 // *****************************************************************************
@@ -149,6 +157,25 @@ __INLINE uint64_t NONNULL_INLINE__ MAX31826_Get_SN(MAX31826_t * const pCpnt) {
 **/
 FctERR NONNULL__ MAX31826_Init_Sequence(MAX31826_t * const pCpnt);
 
+#if OW_DEV_POOL
+/*!\brief MAX31826 peripheral instance creation (allocated from device pool & initialized)
+** \param[in] pOW - pointer to OneWire driver instance
+** \param[in] pROM - Pointer to ROM Id structure
+** \param[out] ppCpnt - Pointer to created MAX31826 peripheral pointer (NULL on failure)
+** \return FctERR - error code
+** \retval ERROR_DEVICE_UNKNOWN - ROM Id family code not matching (nothing allocated)
+** \retval ERROR_MEMORY - Device pool exhausted
+**/
+FctERR NONNULL__ MAX31826_New(OW_DRV * const pOW, const OW_ROM_ID_t * const pROM, MAX31826_t ** const ppCpnt);
+
+/*!\brief MAX31826 peripheral instance deletion (removed device)
+** \note Instance is removed from temperature pipeline, alarm polling & EEPROM scheduler, slave lock identifier is released & instance is returned to device pool
+** \param[in,out] pCpnt - Pointer to MAX31826 peripheral (created with \ref MAX31826_New)
+** \return FctERR - error code
+** \retval ERROR_BUSY - Device transaction, write job or streaming read ongoing, or pipeline or alarm cycle ongoing on bus, instance kept (to be called again later)
+**/
+FctERR NONNULL__ MAX31826_Delete(MAX31826_t * const pCpnt);
+#else
 /*!\brief Initialization for MAX31826 peripheral
 ** \param[in] idx - MAX31826 index
 ** \param[in] pOW - pointer to OneWire driver instance
@@ -163,6 +190,7 @@ FctERR NONNULL__ MAX31826_Init(const uint8_t idx, OW_DRV * const pOW, const OW_R
 ** \return FctERR - error code
 **/
 FctERR MAX31826_Init_Single(const OW_ROM_ID_t * const pROM);
+#endif
 
 
 /*************************************/
@@ -190,6 +218,14 @@ __INLINE FctERR NONNULL_INLINE__ MAX31826_WriteCycle_Handler(MAX31826_t * const
 __INLINE void NONNULL__ MAX31826_Set_Conversion_Mode(MAX31826_t * const pCpnt, const bool automatic) {
 	OW_TEMP_Set_Conversion_Mode(&pCpnt->temp, automatic); }
 
+/*!\brief MAX31826 conversion read profile setter
+** \param[in,out] pCpnt - Pointer to MAX31826 peripheral
+** \param[in] profile - Conversion read profile
+** \param[in] maxDelta - Maximum temperature variation between reads (raw register units, 0 to disable variation check)
+**/
+__INLINE void NONNULL__ MAX31826_Set_Read_Profile(MAX31826_t * const pCpnt, const OW_temp_read_profile profile, const int16_t maxDelta) {
+	OW_TEMP_Set_Read_Profile(&pCpnt->temp, profile, maxDelta); }
+
 /*!\brief MAX31826 start temperature conversion
 ** \param[in,out] pCpnt - Pointer to MAX31826 peripheral
 ** \return FctERR - error code
@@ -231,6 +267,24 @@ __INLINE bool NONNULL__ MAX31826_Get_New_Data(const MAX31826_t * const pCpnt) {
 	return OW_TEMP_Get_New_Data(&pCpnt->temp); }
 
 
+/*!\brief MAX31826 convert last temperature to centi Celsius degrees
+** \note Integer only computation (no floating point)
+** \param[in,out] pCpnt - Pointer to MAX31826 peripheral
+** \return Temperature in centi Celsius degrees
+**/
+__INLINE int32_t NONNULL_INLINE__ MAX31826_Get_Temperature_CentiCelsius(MAX31826_t * const pCpnt) {
+	return OW_TEMP_Get_Temperature_CentiCelsius(&pCpnt->temp); }
+
+/*!\brief MAX31826 convert last temperature to Q8.8 Celsius degrees
+** \note Integer only computation (no floating point)
+** \param[in,out] pCpnt - Pointer to MAX31826 peripheral
+** \return Temperature in Celsius degrees (Q8.8 format)
+**/
+__INLINE int16_t NONNULL_INLINE__ MAX31826_Get_Temperature_Q8(MAX31826_t * const pCpnt) {
+	return OW_TEMP_Get_Temperature_Q8(&pCpnt->temp); }
+
+
+#if OW_TEMP_FLOAT_API
 /*!\brief MAX31826 convert last temperature to Celsius degrees
 ** \param[in,out] pCpnt - Pointer to MAX31826 peripheral
 ** \return Temperature in Celsius degrees
@@ -251,6 +305,7 @@ __INLINE float NONNULL_INLINE__ MAX31826_Get_Temperature_Fahrenheit(MAX31826_t *
 **/
 __INLINE float NONNULL_INLINE__ MAX31826_Get_Temperature_Kelvin(MAX31826_t * const pCpnt) {
 	return OW_TEMP_Get_Temperature_Kelvin(&pCpnt->temp); }
+#endif
 
 
 /**************/
@@ -265,12 +320,25 @@ __INLINE float NONNULL_INLINE__ MAX31826_Get_Temperature_Kelvin(MAX31826_t * con
 **/
 FctERR NONNULL__ MAX31826_Read_Memory(MAX31826_t * const pCpnt, uint8_t * pData, const uint32_t addr, const size_t len);
 
+/*!\brief MAX31826 streaming read (single read memory command, data delivered chunk by chunk)
+** \param[in,out] pCpnt - Pointer to MAX31826 component
+** \param[in] addr - Memory cell start address
+** \param[in] len - Number of data bytes to read
+** \param[in,out] pBuf - Pointer to bounce buffer
+** \param[in] chunk_size - Chunk size (bounce buffer size)
+** \param[in] pfChunk - Chunk delivery function pointer
+** \param[in] pCtx - Chunk delivery user context (may be NULL)
+** \return FctERR - error code
+**/
+__INLINE FctERR NONNULLX__(1, 4, 6) MAX31826_Read_Stream(MAX31826_t * const pCpnt, const uint32_t addr, const size_t len,
+												uint8_t * pBuf, const size_t chunk_size, const pfOW_eepStreamChunk_t pfChunk, void * const pCtx) {
+	return OW_EEP_Read_Stream(&pCpnt->eep, addr, len, pBuf, chunk_size, pfChunk, pCtx); }
+
 /*!\brief MAX31826 write to memory
 ** \note This function allows writing across banks for convenience.
-** 		 Be aware that writing across banks includes programming wait time for each targeted bank (except for single bank or last in the sequence).
-** 		 Non blocking write can be achieved by writing each bank at once manually,
-** 		 after testing return value of \ref MAX31826_WriteCycle_Handler to ensure eeprom is ready for write operation
-** \note In any case, \ref MAX31826_WriteCycle_Handler has to be called somewhere in main like loop to release one wire bus after a write operation.
+** 		 Be aware that writing across banks includes programming wait time for each targeted bank.
+** 		 Non blocking write can be achieved using \ref MAX31826_Write_Memory_Async
+** \note Blocking mode: returns once last row programming time elapsed
 ** \param[in,out] pCpnt - Pointer to MAX31826 component
 ** \param[in] pData - Pointer to data for transmission
 ** \param[in] addr - Target memory cell start address
@@ -279,6 +347,85 @@ FctERR NONNULL__ MAX31826_Read_Memory(MAX31826_t * const pCpnt, uint8_t * pData,
 **/
 FctERR NONNULL__ MAX31826_Write_Memory(MAX31826_t * const pCpnt, const uint8_t * pData, const uint32_t addr, const size_t len);
 
+#if OW_EEP_CACHE
+/*!\brief MAX31826 read through shadow cache
+** \param[in,out] pCpnt - Pointer to MAX31826 component
+** \param[in,out] pData - Pointer to data for reception
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to receive
+** \return FctERR - error code
+**/
+__INLINE FctERR NONNULL_INLINE__ MAX31826_Cache_Read(MAX31826_t * const pCpnt, uint8_t * pData, const uint32_t addr, const size_t len) {
+	return OW_EEP_Cache_Read(&pCpnt->eep, pData, addr, len); }
+
+/*!\brief MAX31826 write to shadow cache
+** \param[in,out] pCpnt - Pointer to MAX31826 component
+** \param[in] pData - Pointer to data for transmission
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to transmit
+** \return FctERR - error code
+**/
+__INLINE FctERR NONNULL_INLINE__ MAX31826_Cache_Write(MAX31826_t * const pCpnt, const uint8_t * pData, const uint32_t addr, const size_t len) {
+	return OW_EEP_Cache_Write(&pCpnt->eep, pData, addr, len); }
+
+/*!\brief MAX31826 shadow cache write back (blocking)
+** \param[in,out] pCpnt - Pointer to MAX31826 component
+** \return FctERR - error code
+**/
+__INLINE FctERR NONNULL_INLINE__ MAX31826_Cache_Flush(MAX31826_t * const pCpnt) {
+	return OW_EEP_Cache_Flush(&pCpnt->eep); }
+#endif
+
+/*!\brief MAX31826 write verification level setter
+** \param[in,out] pCpnt - Pointer to MAX31826 component
+** \param[in] level - Write verification level
+**/
+__INLINE void NONNULL_INLINE__ MAX31826_Set_Verify(MAX31826_t * const pCpnt, const OW_eep_verify level) {
+	OW_EEP_Set_Verify(&pCpnt->eep, level); }
+
+/*!\brief MAX31826 externally powered setter
+** \note Write jobs of devices declared externally powered may be overlapped without strong pull-up by EEPROM write scheduler (default: false)
+** \param[in,out] pCpnt - Pointer to MAX31826 component
+** \param[in] en - Externally powered flag (Vcc pin connected to external supply)
+**/
+__INLINE void NONNULL_INLINE__ MAX31826_Set_Ext_Powered(MAX31826_t * const pCpnt, const bool en) {
+	OW_EEP_Set_Ext_Powered(&pCpnt->eep, en); }
+
+/*!\brief MAX31826 differential writes setter
+** \note When enabled, only rows with changed content are written
+** \param[in,out] pCpnt - Pointer to MAX31826 component
+** \param[in] en - Differential writes enable flag
+**/
+__INLINE void NONNULL_INLINE__ MAX31826_Set_Diff_Write(MAX31826_t * const pCpnt, const bool en) {
+	OW_EEP_Set_Diff_Write(&pCpnt->eep, en); }
+
+/*!\brief MAX31826 differential writes skipped rows getter
+** \param[in] pCpnt - Pointer to MAX31826 component
+** \return Number of rows left untouched by differential writes
+**/
+__INLINE uint32_t NONNULL_INLINE__ MAX31826_Get_Skipped_Rows(const MAX31826_t * const pCpnt) {
+	return OW_EEP_Get_Skipped_Rows(&pCpnt->eep); }
+
+/*!\brief MAX31826 asynchronous write to memory
+** \note Job is handled row by row by \ref MAX31826_Write_Memory_Handler calls, completion is reported by \ref OW_EEP_Write_Memory_Done_Callback
+** \warning Data buffer shall remain valid until job completion
+** \param[in,out] pCpnt - Pointer to MAX31826 component
+** \param[in] pData - Pointer to data for transmission
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to transmit
+** \return FctERR - error code
+**/
+__INLINE FctERR NONNULL_INLINE__ MAX31826_Write_Memory_Async(MAX31826_t * const pCpnt, const uint8_t * pData, const uint32_t addr, const size_t len) {
+	return OW_EEP_Write_Memory_Async(&pCpnt->eep, pData, addr, len); }
+
+/*!\brief MAX31826 asynchronous write job handler
+** \note Handler shall be called periodically in a main like loop or from a timer
+** \param[in,out] pCpnt - Pointer to MAX31826 component
+** \return FctERR - error code (ERROR_BUSY while job is ongoing)
+**/
+__INLINE FctERR NONNULL_INLINE__ MAX31826_Write_Memory_Handler(MAX31826_t * const pCpnt) {
+	return OW_EEP_Write_Memory_Handler(&pCpnt->eep); }
+
 /*!\brief MAX31826 lock memory
 ** \param[in,out] pCpnt - Pointer to MAX31826 component
 ** \param[in] area - EEPROM area to lock
@@ -0,0 +1,466 @@
+/*!\file OW_bench.c
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire drivers micro-benchmark suite
+**/
+/****************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "sarmfsw.h"
+
+#include "OW_drv.h"
+#include "OW_crc.h"
+#include "OW_rom_id.h"
+#include "OW_dev_type.h"
+#include "OW_component.h"
+#include "OW_dev_temp.h"
+
+#include "OW_bench.h"
+
+#if OW_BENCH
+/****************************************************************/
+
+
+#if (OW_BENCH_SEARCH_MAX > 32U)
+#error "OW_BENCH_SEARCH_MAX shall not exceed 32 (simulated devices activity held in 32b mask)"
+#endif
+
+
+#if !defined(OW_PHY_STATIC)
+/*!\enum OW_bench_sim_phase
+** \brief Simulated bus phase
+**/
+typedef enum {
+	OW_BENCH_SIM__IDLE = 0U,	//!< Devices not listening (until next reset)
+	OW_BENCH_SIM__CMD,			//!< ROM command bits reception
+	OW_BENCH_SIM__SEARCH,		//!< Search ROM bits exchange
+} OW_bench_sim_phase;
+
+
+/*!\struct OW_bench_sim_t
+** \brief Simulated bus (synthetic ROM Ids population)
+**/
+typedef struct {
+	OW_ROM_ID_t			rom[OW_BENCH_SEARCH_MAX];	//!< Synthetic ROM Ids
+	uint8_t				nb;							//!< Number of synthetic devices
+	OW_bench_sim_phase	phase;						//!< Current phase
+	uint32_t			active;						//!< Devices still taking part in search (bit mask)
+	uint8_t				cmd;						//!< ROM command being received
+	uint8_t				bitIdx;						//!< Current bit index (in ROM command or ROM Id)
+	uint8_t				step;						//!< Search step for current bit (0: id bit, 1: complement, 2: direction)
+	uint32_t			slots;						//!< Time slots counter (resets included)
+} OW_bench_sim_t;
+#endif
+
+
+#if !defined(OW_PHY_STATIC)
+static OW_bench_sim_t		OW_bench_sim = { 0 };					//!< Simulated bus
+#endif
+static uint8_t				OW_bench_buf[OW_BENCH_BUF_SIZE] = { 0 };	//!< CRC benchmarks buffer
+static uint32_t				OW_bench_rnd = 0x1D872B41U;				//!< Pseudo random generator state
+static volatile uint32_t	OW_bench_sink = 0U;						//!< Results sink (keeps benchmarked calls from being optimized out)
+
+
+/****************************************************************/
+
+
+/*!\brief Pseudo random generator (xorshift32, deterministic sequence for comparable runs)
+** \return Pseudo random value
+**/
+__STATIC uint32_t OW_Bench_Random(void)
+{
+	OW_bench_rnd ^= OW_bench_rnd << 13U;
+	OW_bench_rnd ^= OW_bench_rnd >> 17U;
+	OW_bench_rnd ^= OW_bench_rnd << 5U;
+
+	return OW_bench_rnd;
+}
+
+
+/*!\brief Benchmark case result report
+** \param[in] name - Case name
+** \param[in] mode - Case engine method
+** \param[in] param - Case parameter
+** \param[in] iterations - Number of iterations
+** \param[in] hStart - Case start timestamp
+** \param[in] slots - Bus time slots for one iteration
+**/
+__STATIC void NONNULL__ OW_Bench_Report(const char * const name, const uint8_t mode, const uint32_t param,
+										const uint32_t iterations, const uint32_t hStart, const uint32_t slots)
+{
+	const OW_bench_result_t res = { name, mode, param, iterations, OW_Elapsed_us(hStart), slots };
+
+	OW_Bench_Result_Callback(&res);
+}
+
+
+#if !defined(OW_PHY_STATIC)
+/*!\brief Synthetic device ROM Id bit getter
+** \param[in] dev - Device index
+** \param[in] bit - Bit index in ROM Id (0 to 63)
+** \return Bit value
+**/
+__STATIC_INLINE uint8_t OW_Bench_Sim_ROM_Bit(const uint8_t dev, const uint8_t bit) {
+	return (OW_bench_sim.rom[dev].romId[bit / 8U] >> (bit % 8U)) & 0x01U; }
+
+
+/*!\brief Simulated bus reset
+** \param[in] pOW - Pointer to OneWire driver instance
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_Bench_Sim_Reset(const OW_DRV * const pOW)
+{
+	UNUSED(pOW);
+
+	OW_bench_sim.slots++;
+	OW_bench_sim.phase = OW_BENCH_SIM__CMD;
+	OW_bench_sim.active = (uint32_t) LSHIFT64(1U, OW_bench_sim.nb) - 1U;
+	OW_bench_sim.cmd = 0U;
+	OW_bench_sim.bitIdx = 0U;
+	OW_bench_sim.step = 0U;
+
+	return (OW_bench_sim.nb != 0U) ? ERROR_OK : ERROR_BUSOFF;
+}
+
+
+/*!\brief Simulated bus write bit
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[in] bit - Bit to write
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_Bench_Sim_Write_Bit(const OW_DRV * const pOW, const uint8_t bit)
+{
+	UNUSED(pOW);
+
+	OW_bench_sim.slots++;
+
+	if (OW_bench_sim.phase == OW_BENCH_SIM__CMD)
+	{
+		OW_bench_sim.cmd |= (uint8_t) ((bit & 0x01U) << OW_bench_sim.bitIdx);
+
+		if (++OW_bench_sim.bitIdx == 8U)
+		{
+			OW_bench_sim.phase = (OW_bench_sim.cmd == OW__SEARCH_ROM) ? OW_BENCH_SIM__SEARCH : OW_BENCH_SIM__IDLE;
+			OW_bench_sim.bitIdx = 0U;
+		}
+	}
+	else if ((OW_bench_sim.phase == OW_BENCH_SIM__SEARCH) && (OW_bench_sim.step == 2U))
+	{
+		for (uint8_t i = 0U ; i < OW_bench_sim.nb ; i++)	// Devices not matching direction leave search
+		{
+			if (OW_Bench_Sim_ROM_Bit(i, OW_bench_sim.bitIdx) != (bit & 0x01U))	{ OW_bench_sim.active &= ~LSHIFT32(1U, i); }
+		}
+
+		OW_bench_sim.step = 0U;
+		if (++OW_bench_sim.bitIdx == 64U)	{ OW_bench_sim.phase = OW_BENCH_SIM__IDLE; }
+	}
+	else {}
+
+	return ERROR_OK;
+}
+
+
+/*!\brief Simulated bus read bit
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[out] pBit - Pointer to read bit
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_Bench_Sim_Read_Bit(const OW_DRV * const pOW, uint8_t * const pBit)
+{
+	UNUSED(pOW);
+
+	OW_bench_sim.slots++;
+	*pBit = 1U;		// Idle line level (pulled-up)
+
+	if ((OW_bench_sim.phase == OW_BENCH_SIM__SEARCH) && (OW_bench_sim.step < 2U))
+	{
+		for (uint8_t i = 0U ; i < OW_bench_sim.nb ; i++)	// Wired-AND of active devices bit (or complement)
+		{
+			if ((OW_bench_sim.active & LSHIFT32(1U, i)) != 0U)
+			{
+				*pBit &= OW_Bench_Sim_ROM_Bit(i, OW_bench_sim.bitIdx) ^ OW_bench_sim.step;
+			}
+		}
+
+		OW_bench_sim.step++;
+	}
+
+	return ERROR_OK;
+}
+
+
+#if OW_CUSTOM_BYTE_HANDLERS
+/*!\brief Simulated bus write byte
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[in] data - Byte to write
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_Bench_Sim_Write_Byte(const OW_DRV * const pOW, const uint8_t data)
+{
+	for (uint8_t i = 0U ; i < 8U ; i++)		{ UNUSED_RET OW_Bench_Sim_Write_Bit(pOW, (data >> i) & 0x01U); }
+
+	return ERROR_OK;
+}
+
+
+/*!\brief Simulated bus read byte
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[out] pData - Pointer to read byte
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_Bench_Sim_Read_Byte(const OW_DRV * const pOW, uint8_t * const pData)
+{
+	*pData = 0U;
+
+	for (uint8_t i = 0U ; i < 8U ; i++)
+	{
+		uint8_t bit;
+
+		UNUSED_RET OW_Bench_Sim_Read_Bit(pOW, &bit);
+		*pData |= (uint8_t) (bit << i);
+	}
+
+	return ERROR_OK;
+}
+#endif
+
+
+/*!\brief Simulated bus synthetic ROM Ids population generation
+** \param[in] nb - Number of synthetic devices
+**/
+__STATIC void OW_Bench_Sim_Populate(const uint8_t nb)
+{
+	OW_bench_sim.nb = nb;
+
+	for (uint8_t i = 0U ; i < nb ; i++)
+	{
+		OW_ROM_ID_t * const pROM = &OW_bench_sim.rom[i];
+
+		pROM->familyCode = OW_TYPE__PROG_RED_THERMOMETER;
+		for (size_t j = 0U ; j < sizeof(pROM->serialNumber) ; j++)	{ pROM->serialNumber[j] = (uint8_t) OW_Bench_Random(); }
+
+		pROM->crc = 0U;
+		OWCompute_DallasCRC8(&pROM->crc, pROM->romId, OW_ROM_ID_SIZE - 1U);
+	}
+}
+#endif
+
+
+/****************************************************************/
+
+
+void OW_Bench_CRC(const uint32_t iterations)
+{
+	for (size_t i = 0U ; i < sizeof(OW_bench_buf) ; i++)	{ OW_bench_buf[i] = (uint8_t) OW_Bench_Random(); }
+
+	for (size_t size = 8U ; size <= sizeof(OW_bench_buf) ; size *= 4U)
+	{
+		uint8_t		crc8 = 0U;
+		uint16_t	crc16 = 0U;
+		uint32_t	hStart;
+		FctERR		err = ERROR_OK;
+
+		hStart = OW_Timestamp();
+		for (uint32_t i = 0U ; i < iterations ; i++)	{ OWCompute_DallasCRC8(&crc8, OW_bench_buf, size); }
+		OW_Bench_Report("crc8", ONEWIRE_CRC8_TABLE, size, iterations, hStart, 0U);
+
+		hStart = OW_Timestamp();
+		for (uint32_t i = 0U ; i < iterations ; i++)	{ OWCompute_DallasCRC16(&crc16, OW_bench_buf, size); }
+		OW_Bench_Report("crc16", ONEWIRE_CRC16_TABLE, size, iterations, hStart, 0U);
+
+		hStart = OW_Timestamp();
+		for (uint32_t i = 0U ; i < iterations ; i++)	{ err |= OWCheck_DallasCRC8(OW_bench_buf, size, crc8); }
+		OW_Bench_Report("crc8_check", ONEWIRE_CRC8_TABLE, size, iterations, hStart, 0U);
+
+		hStart = OW_Timestamp();
+		for (uint32_t i = 0U ; i < iterations ; i++)	{ err |= OWCheck_DallasCRC16(OW_bench_buf, size, crc16); }
+		OW_Bench_Report("crc16_check", ONEWIRE_CRC16_TABLE, size, iterations, hStart, 0U);
+
+		OW_bench_sink += crc8 + crc16 + err;
+	}
+}
+
+
+FctERR NONNULL__ OW_Bench_Search(OW_DRV * const pOW, const uint8_t nb, const uint32_t iterations)
+{
+	FctERR err = ERROR_OK;
+
+#if defined(OW_PHY_STATIC)
+	UNUSED(pOW);
+	UNUSED(nb);
+	UNUSED(iterations);
+
+	err = ERROR_NOTAVAIL;		// Simulated bus can't replace statically bound physical layer
+#else
+	if ((nb == 0U) || (nb > OW_BENCH_SEARCH_MAX))
+	{
+		err = ERROR_RANGE;
+		goto ret;
+	}
+
+	// Bus physical handlers & search context backup
+	const pfOW_phyReset_t	pfReset = pOW->pfReset;
+	const pfOW_phyWrite_t	pfWriteBit = pOW->pfWriteBit;
+	const pfOW_phyRead_t	pfReadBit = pOW->pfReadBit;
+#if OW_CUSTOM_BYTE_HANDLERS
+	const pfOW_phyWrite_t	pfWriteByte = pOW->pfWriteByte;
+	const pfOW_phyRead_t	pfReadByte = pOW->pfReadByte;
+#endif
+	const uint8_t			search_type = pOW->search_type;
+	OWSearch_State_t		search_state;
+
+	UNUSED_RET memcpy(&search_state, &pOW->search_state, sizeof(OWSearch_State_t));
+
+	pOW->pfReset = OW_Bench_Sim_Reset;
+	pOW->pfWriteBit = OW_Bench_Sim_Write_Bit;
+	pOW->pfReadBit = OW_Bench_Sim_Read_Bit;
+#if OW_CUSTOM_BYTE_HANDLERS
+	pOW->pfWriteByte = OW_Bench_Sim_Write_Byte;
+	pOW->pfReadByte = OW_Bench_Sim_Read_Byte;
+#endif
+	OWSearch_SetType(pOW, OW__SEARCH_ROM);
+
+	OW_Bench_Sim_Populate(nb);
+	OW_bench_sim.slots = 0U;
+
+	const uint32_t hStart = OW_Timestamp();
+
+	for (uint32_t i = 0U ; (i < iterations) && (err == ERROR_OK) ; i++)
+	{
+		OW_ROM_ID_t	rom;
+		uint8_t		found = 0U;
+		FctERR		errSearch = OWSearch_First(pOW, &rom);
+
+		while (errSearch == ERROR_OK)
+		{
+			found++;
+			OW_bench_sink += rom.crc;
+
+			if (pOW->search_state.lastDeviceFlag)	{ break; }
+
+			errSearch = OWSearch_Next(pOW, &rom);
+		}
+
+		if (found != nb)	{ err = ERROR_VALUE; }
+	}
+
+	if (err == ERROR_OK)	{ OW_Bench_Report("search", 0U, nb, iterations, hStart, OW_bench_sim.slots / max(iterations, 1U)); }
+
+	// Bus physical handlers & search context restore
+	pOW->pfReset = pfReset;
+	pOW->pfWriteBit = pfWriteBit;
+	pOW->pfReadBit = pfReadBit;
+#if OW_CUSTOM_BYTE_HANDLERS
+	pOW->pfWriteByte = pfWriteByte;
+	pOW->pfReadByte = pfReadByte;
+#endif
+	OWSearch_SetType(pOW, search_type);
+
+	UNUSED_RET memcpy(&pOW->search_state, &search_state, sizeof(OWSearch_State_t));
+
+	ret:
+#endif
+	return err;
+}
+
+
+void OW_Bench_Conversions(const uint32_t iterations)
+{
+	static const uint16_t			convTimes[] = { 94, 188, 375, 750 };
+	static const OW_temp_props_t	props = { convTimes, OW_TEMP__RES_9BIT, OW_TEMP__RES_12BIT, 0.0625f, 3, 4 };	// DS18B20 like sensor
+	OW_temp_t						temp;
+	OW_ROM_ID_t						rom;
+	uint32_t						hStart;
+
+	UNUSED_RET memset(&temp, 0, sizeof(temp));
+	temp.props = &props;
+	temp.resIdx = OW_TEMP__RES_12BIT;
+
+	for (size_t i = 0U ; i < OW_ROM_ID_SIZE ; i++)	{ rom.romId[i] = (uint8_t) OW_Bench_Random(); }
+
+	hStart = OW_Timestamp();
+	for (uint32_t i = 0U ; i < iterations ; i++)
+	{
+		rom.serialNumber[0] = (uint8_t) i;
+		OW_bench_sink += (uint32_t) OWGetSerialNumber(&rom);
+	}
+	OW_Bench_Report("serial_number", 0U, 0U, iterations, hStart, 0U);
+
+	hStart = OW_Timestamp();
+	for (uint32_t i = 0U ; i < iterations ; i++)
+	{
+		temp.tempConv = (int16_t) ((i & 0x7FFU) - 0x370);	// -55 to 73 Celsius degrees range
+		OW_bench_sink += (uint32_t) OW_TEMP_Get_Temperature_CentiCelsius(&temp);
+	}
+	OW_Bench_Report("temp_centi", 0U, 0U, iterations, hStart, 0U);
+
+	hStart = OW_Timestamp();
+	for (uint32_t i = 0U ; i < iterations ; i++)
+	{
+		temp.tempConv = (int16_t) ((i & 0x7FFU) - 0x370);
+		OW_bench_sink += (uint32_t) OW_TEMP_Get_Temperature_Q8(&temp);
+	}
+	OW_Bench_Report("temp_q8", 0U, 0U, iterations, hStart, 0U);
+
+#if OW_TEMP_FLOAT_API
+	hStart = OW_Timestamp();
+	for (uint32_t i = 0U ; i < iterations ; i++)
+	{
+		temp.tempConv = (int16_t) ((i & 0x7FFU) - 0x370);
+		OW_bench_sink += (uint32_t) (int32_t) OW_TEMP_Get_Temperature_Celsius(&temp);
+	}
+	OW_Bench_Report("temp_float", 0U, 0U, iterations, hStart, 0U);
+#endif
+}
+
+
+FctERR NONNULL__ OW_Bench_Run(OW_DRV * const pOW, const uint32_t iterations)
+{
+	static const uint8_t	populations[] = { 1U, 4U, 16U, OW_BENCH_SEARCH_MAX };
+	FctERR					err = ERROR_OK;
+
+	OW_Bench_CRC(iterations);
+
+#if !defined(OW_PHY_STATIC)
+	for (size_t i = 0U ; (i < sizeof(populations)) && (err == ERROR_OK) ; i++)
+	{
+		if (populations[i] <= OW_BENCH_SEARCH_MAX)	{ err = OW_Bench_Search(pOW, populations[i], iterations); }
+	}
+#else
+	UNUSED(pOW);
+	UNUSED(populations);
+#endif
+
+	OW_Bench_Conversions(iterations);
+
+	return err;
+}
+
+
+/****************************************************************/
+
+
+__WEAK void NONNULL__ OW_Bench_Result_Callback(const OW_bench_result_t * const pRes)
+{
+	UNUSED(pRes);
+
+	// cppcheck-suppres misra-c2012-3.1
+	/**\code
+	char line[64];
+
+	if (OW_Bench_Format_CSV(line, sizeof(line), pRes) > 0)	{ UART_Send_String(line); }
+	\endcode**/
+}
+
+
+int NONNULL__ OW_Bench_Format_CSV(char * const pStr, const size_t size, const OW_bench_result_t * const pRes)
+{
+	return snprintf(pStr, size, "%s,%u,%lu,%lu,%lu,%lu\n", pRes->name, (unsigned int) pRes->mode, (unsigned long) pRes->param,
+					(unsigned long) pRes->iterations, (unsigned long) pRes->total_us, (unsigned long) pRes->slots);
+}
+
+
+/****************************************************************/
+#endif
+/****************************************************************/
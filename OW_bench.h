@@ -0,0 +1,117 @@
+/*!\file OW_bench.h
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire drivers micro-benchmark suite
+** \note Enabled defining OW_BENCH to 1: CRC engines (following ONEWIRE_CRC8_TABLE & ONEWIRE_CRC16_TABLE), search state machine
+**		 against synthetic ROM Id populations (simulated bus), serial number and temperature getters.
+** \note Each case result is delivered to \ref OW_Bench_Result_Callback, \ref OW_Bench_Format_CSV formats it as a CSV line
+**		 (header: \ref OW_BENCH_CSV_HEADER), to be compared between drivers versions.
+** \warning Search benchmark replaces bus physical handlers during run (bus shall be idle, without any slave transaction ongoing).
+** \warning Each case is timed with \ref OW_Elapsed_us (32 bits): with DWT timestamps (OW_DRV_CYCCNT), a case shall last less than
+**			2^32 / SystemCoreClock seconds (e.g. ~25s at 168MHz, ~8.9s at 480MHz), iterations to be sized accordingly.
+**/
+/****************************************************************/
+#ifndef OW_BENCH_H__
+	#define OW_BENCH_H__
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+#include "sarmfsw.h"
+
+#include "OW_drv.h"
+
+#if OW_BENCH
+/****************************************************************/
+
+
+#ifndef OW_BENCH_BUF_SIZE
+#define OW_BENCH_BUF_SIZE		512U	//!< Largest buffer size for CRC benchmarks (sizes from 8 bytes, multiplied by 4 up to this size)
+#endif
+
+#ifndef OW_BENCH_SEARCH_MAX
+#define OW_BENCH_SEARCH_MAX		32U		//!< Largest synthetic ROM Id population for search benchmarks
+#endif
+/****************************************************************/
+
+
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+#define OW_BENCH_CSV_HEADER		"case,mode,param,iterations,total_us,slots\n"		//!< CSV header line matching \ref OW_Bench_Format_CSV lines
+
+
+// *****************************************************************************
+// Section: Types
+// *****************************************************************************
+/*!\struct OW_bench_result_t
+** \brief Benchmark case result
+**/
+typedef struct {
+	const char *	name;			//!< Case name
+	uint8_t			mode;			//!< Case engine method (CRC table method, 0 if not relevant)
+	uint32_t		param;			//!< Case parameter (buffer size, number of devices, 0 if not relevant)
+	uint32_t		iterations;		//!< Number of iterations
+	uint32_t		total_us;		//!< Total elapsed time for all iterations (in us)
+	uint32_t		slots;			//!< Bus time slots (resets included) for one iteration (0 if not relevant)
+} OW_bench_result_t;
+
+
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+/*!\brief CRC engines benchmark (OWCompute_DallasCRC8/16 & OWCheck_DallasCRC8/16 for each buffer size)
+** \param[in] iterations - Number of iterations for each case
+**/
+void OW_Bench_CRC(const uint32_t iterations);
+
+/*!\brief Search state machine benchmark on simulated bus
+** \note Bus physical handlers are replaced by a simulated bus holding \b nb synthetic ROM Ids, then restored
+** \note CPU time per device is total_us / (iterations * nb), bus time is slots * OW_SLOT_TIME_US on a real bus
+** \param[in,out] pOW - Pointer to OneWire driver instance (initialized, idle)
+** \param[in] nb - Number of synthetic devices (up to \ref OW_BENCH_SEARCH_MAX)
+** \param[in] iterations - Number of whole searches
+** \return FctERR - error code
+** \retval ERROR_VALUE - Found devices not matching synthetic population
+** \retval ERROR_NOTAVAIL - Physical layer statically bound (OW_PHY_STATIC defined)
+**/
+FctERR NONNULL__ OW_Bench_Search(OW_DRV * const pOW, const uint8_t nb, const uint32_t iterations);
+
+/*!\brief Serial number & temperature getters benchmark
+** \param[in] iterations - Number of iterations for each case
+**/
+void OW_Bench_Conversions(const uint32_t iterations);
+
+/*!\brief Whole benchmark suite (CRC, search with 1, 4, 16 & \ref OW_BENCH_SEARCH_MAX devices, conversions)
+** \param[in,out] pOW - Pointer to OneWire driver instance (initialized, idle)
+** \param[in] iterations - Number of iterations for each case
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_Bench_Run(OW_DRV * const pOW, const uint32_t iterations);
+
+
+/*!\brief Benchmark case result callback
+** \weak Weak implementation (does nothing), to be implemented in user code (e.g. send CSV line over serial link)
+** \param[in] pRes - Pointer to case result
+**/
+void NONNULL__ OW_Bench_Result_Callback(const OW_bench_result_t * const pRes);
+
+/*!\brief Benchmark case result CSV line formatting (fields following \ref OW_BENCH_CSV_HEADER)
+** \param[out] pStr - Pointer to output string
+** \param[in] size - Output string size
+** \param[in] pRes - Pointer to case result
+** \return Number of characters of formatted line (snprintf like)
+**/
+int NONNULL__ OW_Bench_Format_CSV(char * const pStr, const size_t size, const OW_bench_result_t * const pRes);
+
+
+/****************************************************************/
+#endif
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif
+/****************************************************************/
@@ -12,6 +12,9 @@
 /****************************************************************/
 
 
+static OW_slave_t *	OW_slaves[OW_BUS_NB] = { 0 };	//!< Slaves registered on each bus (linked through pNext)
+
+
 /*!\brief OneWire Salve get power supply source
 ** \note May be useful to keep bus as busy during a copy scratchpad command or during a conversion (line should be held high, no other transaction allowed on bus)
 ** \warning Use only if device supports the command (meaning it can be powered by power or bus), otherwise result will be wrong and irrelevant
@@ -40,17 +43,141 @@ __STATIC FctERR NONNULL__ OW_slave_get_power_supply(OW_slave_t * const pSlave)
 }
 
 
-void NONNULL__ OW_slave_init(OW_slave_t * const pSlave, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
+/*!\brief OW Slave registration lookup
+** \param[in] pSlave - pointer to OW slave instance
+** \param[out] pBus - Pointer to index of bus slave is registered on
+** \return Pointer to registered slaves list link pointing to \b pSlave (NULL if not registered)
+**/
+__STATIC OW_slave_t ** NONNULL__ OW_slave_find_link(const OW_slave_t * const pSlave, uintCPU_t * const pBus)
+{
+	OW_slave_t ** ppLink = NULL;
+
+	for (uintCPU_t i = 0 ; (i < OW_BUS_NB) && (ppLink == NULL) ; i++)
+	{
+		for (OW_slave_t ** pp = &OW_slaves[i] ; *pp != NULL ; pp = &(*pp)->pNext)
+		{
+			if (*pp == pSlave)
+			{
+				ppLink = pp;
+				*pBus = i;
+				break;
+			}
+		}
+	}
+
+	return ppLink;
+}
+
+
+FctERR NONNULL__ OW_slave_init(OW_slave_t * const pSlave, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
 {
 	/* Check the parameters */
 	//assert_param(IS_OW_ALL_INSTANCE(pOW->Instance));
 
+	const int32_t	idx = pOW - OWdrv;
+	uintCPU_t		bus = 0;
+	bool			registered = (OW_slave_find_link(pSlave, &bus) != NULL);
+	OW_mutex_t		id = OW_LOCK_ID_FREE;
+	FctERR			err = ERROR_OK;
+
+	if (!IS_OW_DRV_IDX((uint32_t) idx))
+	{
+		err = ERROR_INSTANCE;
+		goto ret;
+	}
+
+	if (registered)
+	{
+		if (bus == (uintCPU_t) idx)	{ id = pSlave->cfg.mutex_id; }	// Initialized again on the same bus (registered identifier kept)
+		else
+		{
+			OW_slave_deinit(pSlave);	// Moved to another bus
+			registered = false;
+		}
+	}
+
 	pSlave->cfg.bus_inst = pOW;
-	pSlave->cfg.mutex_id = OWInit_Get_Device_Lock_ID(pOW);
+
+	if (!registered)
+	{
+		id = OWInit_Get_Device_Lock_ID(pOW);
+		pSlave->busy = false;
+	}
+
+	pSlave->cfg.mutex_id = id;
+
+	if (id == OW_LOCK_ID_FREE)
+	{
+		pSlave->en = false;
+		err = ERROR_OVERFLOW;
+		goto ret;
+	}
+
+	if (!registered)
+	{
+		pSlave->pNext = OW_slaves[idx];
+		OW_slaves[idx] = pSlave;
+	}
+
 	pSlave->en = true;
 
 	OW_set_slave_id(pSlave, pROM);
 	UNUSED_RET OW_slave_get_power_supply(pSlave);
+
+	ret:
+	return err;
+}
+
+
+void NONNULL__ OW_slave_deinit(OW_slave_t * const pSlave)
+{
+	uintCPU_t			bus = 0;
+	OW_slave_t ** const	ppLink = OW_slave_find_link(pSlave, &bus);
+
+	if (ppLink != NULL)
+	{
+		*ppLink = pSlave->pNext;	// Unregistered from bus
+		UNUSED_RET OW_Release_Device_Lock_ID(&OWdrv[bus], pSlave->cfg.mutex_id);
+	}
+
+	pSlave->cfg.mutex_id = OW_LOCK_ID_FREE;
+	pSlave->pNext = NULL;
+	pSlave->en = false;
+	pSlave->busy = false;
+}
+
+
+bool NONNULL__ OW_bus_is_busy(const OW_DRV * const pOW)
+{
+	const int32_t	idx = pOW - OWdrv;
+	bool			busy = false;
+
+	if (IS_OW_DRV_IDX((uint32_t) idx))
+	{
+		for (const OW_slave_t * pSlave = OW_slaves[idx] ; (pSlave != NULL) && !busy ; pSlave = pSlave->pNext)
+		{
+			busy = OW_is_busy(pSlave);
+		}
+	}
+
+	return busy;
+}
+
+
+OW_slave_t * NONNULL__ OW_get_slave_by_lock_id(const OW_DRV * const pOW, const OW_mutex_t id)
+{
+	const int32_t	idx = pOW - OWdrv;
+	OW_slave_t *	pSlave = NULL;
+
+	if (IS_OW_DRV_IDX((uint32_t) idx) && (id != OW_LOCK_ID_FREE))
+	{
+		for (pSlave = OW_slaves[idx] ; pSlave != NULL ; pSlave = pSlave->pNext)
+		{
+			if (pSlave->cfg.mutex_id == id)	{ break; }
+		}
+	}
+
+	return pSlave;
 }
 
 
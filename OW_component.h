@@ -57,10 +57,27 @@ typedef enum PACK__ {
 } OW_ROM_cmd;
 
 
+/*!\enum OW_slave_op
+** \brief One Wire slave operation types (latency histograms)
+**/
+typedef enum PACK__ {
+	OW_SLAVE_OP__READ_SCRATCHPAD = 0U,	//!< Read scratchpad transaction
+	OW_SLAVE_OP__CONVERSION,			//!< Conversion (start to end of conversion detection)
+	OW_SLAVE_OP__EEP_WRITE,				//!< EEPROM write job (submission to completion)
+	OW_SLAVE_OP__NB						//!< Number of operation types
+} OW_slave_op;
+
+#if OW_SLAVE_HISTO
+#define OW_SLAVE_HISTO_RECORD(pSlave, op, us)	OW_Histo_Record(&(pSlave)->histo[(op)], (us))	//!< Macro to record \b us latency of \b op operation for \b pSlave
+#else
+#define OW_SLAVE_HISTO_RECORD(pSlave, op, us)	do {} while (0)									//!< Macro to record \b us latency of \b op operation for \b pSlave (histograms disabled)
+#endif
+
+
 /*! \struct OW_slave_t
 **  \brief One Wire slave config and control parameters
 **/
-typedef struct {
+typedef struct sOW_slave {
 	/*! \struct cfg
 	**  \brief OW pSlave parameters
 	**/
@@ -72,6 +89,10 @@ typedef struct {
 	} cfg;
 	bool			en;					//!< State of pSlave (disabled/enabled)
 	bool			busy;				//!< Device busy flag (ongoing operation), useful for devices including multiple functionalities
+	struct sOW_slave *	pNext;			//!< Next slave registered on the same bus (lock identifiers lookup)
+#if OW_SLAVE_HISTO
+	OW_histo_t		histo[OW_SLAVE_OP__NB];	//!< Latency histograms per operation type
+#endif
 } OW_slave_t;
 
 
@@ -80,17 +101,50 @@ typedef struct {
 // *****************************************************************************
 /*!\brief OW Slave device initialization
 ** \hidecallergraph
+** \note Slave is registered on bus (instance fields are not relied upon, instance may not be zeroed),
+**		 lock identifier is kept when slave instance is initialized again on the same bus
 ** \param[in,out] pSlave - pointer to OW slave instance to initialize
 ** \param[in] pOW - pointer to HAL OW instance
 ** \param[in] pROM - pointer to ROM Id
+** \return FctERR - Error code
+** \retval ERROR_INSTANCE - Unknown bus instance
+** \retval ERROR_OVERFLOW - No lock identifier left on bus (see \ref OW_LOCK_ID_MAX)
+**/
+FctERR NONNULL__ OW_slave_init(OW_slave_t * const pSlave, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM);
+
+/*!\brief OW Slave device deinitialization (removed device)
+** \note Slave is unregistered from bus, lock identifier is released (reused by next initialized slave) and slave is disabled
+** \param[in,out] pSlave - pointer to OW slave instance to deinitialize
+**/
+void NONNULL__ OW_slave_deinit(OW_slave_t * const pSlave);
+
+/*!\brief OW Slave device lookup from bus lock identifier
+** \param[in] pOW - pointer to HAL OW instance
+** \param[in] id - Device lock identifier (e.g. from \ref OW_Get_Bus_Owner or trace lock denied event)
+** \return Pointer to OW slave instance registered with \b id on bus (NULL if none, bus free or held by driver)
+**/
+OW_slave_t * NONNULL__ OW_get_slave_by_lock_id(const OW_DRV * const pOW, const OW_mutex_t id);
+
+/*!\brief OW bus busy state (any slave registered on bus busy)
+** \note To be checked before broadcast (Skip ROM) transactions, which would disturb any ongoing slave operation on bus
+** \param[in] pOW - pointer to HAL OW instance
+** \return true if at least one slave registered on bus is busy
+**/
+bool NONNULL__ OW_bus_is_busy(const OW_DRV * const pOW);
+
+/*!\brief OW Slave device holding bus lock getter
+** \param[in] pOW - pointer to HAL OW instance
+** \return Pointer to OW slave instance owning bus (NULL if bus free or held by driver)
 **/
-void NONNULL__ OW_slave_init(OW_slave_t * const pSlave, OW_DRV * const pOW, const OW_ROM_ID_t * const pROM);
+__INLINE OW_slave_t * NONNULL_INLINE__ OW_get_bus_owner_slave(const OW_DRV * const pOW) {
+	return OW_get_slave_by_lock_id(pOW, OW_Get_Bus_Owner(pOW)); }
 
 
 /***************/
 /*** SETTERS ***/
 /***************/
 /*!\brief OW Slave device HAL instance change
+** \warning Slave registration (lock identifier) is not moved, use \ref OW_slave_init to move an initialized slave to another bus
 ** \param[in,out] pSlave - pointer to OW slave instance
 ** \param[in] pOW - pointer to HAL OW instance
 **/
@@ -145,6 +199,13 @@ __INLINE bool NONNULL_INLINE__ OW_is_busy(const OW_slave_t * const pSlave) {
 __INLINE OW_DRV * NONNULL_INLINE__ OW_get_pSlave_instance(const OW_slave_t * const pSlave) {
 	return pSlave->cfg.bus_inst; }
 
+/*!\brief Get OW slave device bus lock identifier
+** \param[in] pSlave - pointer to OW slave instance
+** \return OW slave device bus lock identifier (compare with \ref OW_Get_Bus_Owner)
+**/
+__INLINE OW_mutex_t NONNULL_INLINE__ OW_get_slave_lock_id(const OW_slave_t * const pSlave) {
+	return pSlave->cfg.mutex_id; }
+
 /*!\brief Get OW slave device id
 ** \param[in] pSlave - pointer to OW slave instance
 ** \return OW slave device id
@@ -152,6 +213,16 @@ __INLINE OW_DRV * NONNULL_INLINE__ OW_get_pSlave_instance(const OW_slave_t * con
 __INLINE OW_ROM_ID_t NONNULL_INLINE__ OW_get_slave_id(const OW_slave_t * const pSlave) {
 	return pSlave->cfg.ROM_ID; }
 
+#if OW_SLAVE_HISTO
+/*!\brief Get OW slave operation latency histogram
+** \param[in] pSlave - pointer to OW slave instance
+** \param[in] op - Operation type
+** \return Pointer to operation latency histogram
+**/
+__INLINE const OW_histo_t * NONNULL_INLINE__ OW_get_slave_histo(const OW_slave_t * const pSlave, const OW_slave_op op) {
+	return &pSlave->histo[op]; }
+#endif
+
 /*!\brief Get OW slave power source
 ** \param[in] pSlave - pointer to OW slave instance
 ** \return OW slave power source (true when parasite powered)
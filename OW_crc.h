@@ -14,7 +14,11 @@
 #include "sarmfsw.h"
 
 #ifndef ONEWIRE_CRC8_TABLE
-#define ONEWIRE_CRC8_TABLE	0	//!< Select table-lookup method if set to 1 (table enlarges code size by about 250 bytes)
+#define ONEWIRE_CRC8_TABLE	0	//!< CRC8 method: 0: bit-serial, 1: table-lookup (table enlarges code size by about 250 bytes), 2: nibble table-lookup (16 bytes table)
+#endif
+
+#ifndef ONEWIRE_CRC16_TABLE
+#define ONEWIRE_CRC16_TABLE	0	//!< CRC16 method: 0: bit-serial, 1: table-lookup (512 bytes table), 2: nibble table-lookup (32 bytes table), 3: slicing-by-4 (2KB tables, for bulk EEPROM verifications)
 #endif
 /****************************************************************/
 
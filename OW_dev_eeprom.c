@@ -12,14 +12,39 @@
 /****************************************************************/
 
 
+/*!\brief OneWire EEPROM device copy status polling availability
+** \note Only devices declared externally powered are polled (power supply read result is not trusted: parasite only devices do not answer it)
+** \param[in] pEEP - Pointer to EEPROM device type structure
+** \return true if copy completion can be polled on device
+**/
+__STATIC_INLINE bool NONNULL_INLINE__ OW_EEP_Copy_Status_Polled(const OW_eep_t * const pEEP) {
+	return pEEP->props->copy_status && pEEP->extPowered && !pEEP->overlap; }	// Copy session shall not be interrupted by other transactions
+
+
 FctERR NONNULL__ OW_EEP_WriteCycle_Handler(OW_eep_t * const pEEP)
 {
 	FctERR err = ERROR_OK;
 
 	if (!pEEP->doneWrite)
 	{
-		if (TPSSUP_MS(pEEP->hStartWrite, pEEP->props->write_cycle_time + 1U))	// Add 1ms to max write time
+		bool done = TPSSUP_MS(pEEP->hStartWrite, pEEP->props->write_cycle_time + 1U);	// Add 1ms to max write time
+
+		if (!done && OW_EEP_Copy_Status_Polled(pEEP))
+		{
+			uint8_t status = 0U;
+
+			if (OWRead_byte(pEEP->slave_inst->cfg.bus_inst, &status) == ERROR_OK)
+			{
+				done = ((status == 0xAAU) || (status == 0x55U));	// Alternating pattern sent once programming is done
+			}
+		}
+
+		if (done)
 		{
+			const uint32_t tProg = HALTicks() - pEEP->hStartWrite;
+
+			pEEP->tProgLast = (uint8_t) min(tProg, UINT8_MAX);
+			pEEP->tProgMax = max(pEEP->tProgMax, pEEP->tProgLast);
 			pEEP->doneWrite = true;
 
 			OW_StrongPull_Set(pEEP->slave_inst->cfg.bus_inst, false);
@@ -49,21 +74,26 @@ __STATIC FctERR NONNULL__ OW_EEP_Copy_Scratchpad(OW_eep_t * const pEEP)
 
 	OW_set_busy(pSlave, true);
 
+	// Not retried: copy could have started at first attempt
 	FctERR err = OWROMCmd_Control_Sequence(pSlave->cfg.bus_inst, &pSlave->cfg.ROM_ID, false);
+
+	if (err == ERROR_OK)
+	{
+		const uint8_t mask_bits = pEEP->props->scratchpad_size - 1U;
+		const uint8_t cmd[4] = { OW_EEP__COPY_SCRATCHPAD, LOBYTE(pEEP->scratch.address), HIBYTE(pEEP->scratch.address), pEEP->scratch.ES & mask_bits };
+		err = OWWrite(pDrv, cmd, sizeof(cmd));
+	}
+
 	if (err != ERROR_OK)
 	{
 		OW_set_busy(pSlave, false);
 		goto ret;
 	}
 
-	const uint8_t mask_bits = pEEP->props->scratchpad_size - 1U;
-	const uint8_t cmd[4] = { OW_EEP__COPY_SCRATCHPAD, LOBYTE(pEEP->scratch.address), HIBYTE(pEEP->scratch.address), pEEP->scratch.ES & mask_bits };
-	UNUSED_RET OWWrite(pDrv, cmd, sizeof(cmd));
-
 	pEEP->hStartWrite = HALTicks();
 	pEEP->doneWrite = false;
 
-	OW_StrongPull_Set(pEEP->slave_inst->cfg.bus_inst, true);
+	if (OW_EEP_Copy_Strong_Pull(pEEP))	{ OW_StrongPull_Set(pEEP->slave_inst->cfg.bus_inst, true); }
 
 	// Do not release slave at this stage, copy to eeprom is ongoing
 
@@ -72,47 +102,69 @@ __STATIC FctERR NONNULL__ OW_EEP_Copy_Scratchpad(OW_eep_t * const pEEP)
 }
 
 
-FctERR NONNULL__ OW_EEP_Read_Scratchpad(OW_eep_t * const pEEP)
+/*!\brief OneWire EEPROM device read scratchpad transaction (single attempt)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_EEP_Read_Scratchpad_Transaction(OW_eep_t * const pEEP)
 {
 	OW_slave_t * const		pSlave = pEEP->slave_inst;
 	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
-	uWord					crc;
+	const uint8_t			cmd = OW_EEP__READ_SCRATCHPAD;
+	uint16_t				crc16 = 0U;
+	uint8_t					crc[2];
 	uint8_t					tmp[3];
-	FctERR					err = ERROR_OK;
 
-	if (!OW_is_enabled(pSlave))		{ err = ERROR_DISABLED; }	// Peripheral disabled
-	if (OW_is_busy(pSlave))			{ err = ERROR_BUSY; }		// Device busy
-	if (!pEEP->doneWrite)			{ err = ERROR_BUSY; }		// Copy in progess
-	if (err != ERROR_OK)			{ goto ret; }
+	OWCompute_DallasCRC16(&crc16, &cmd, 1U);
 
-	OW_set_busy(pSlave, true);
-
-	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)			{ goto err; }
-
-	UNUSED_RET OWWrite_byte(pDrv, OW_EEP__READ_SCRATCHPAD);
-	UNUSED_RET OWRead(pDrv, tmp, sizeof(tmp));
+	// CRC16 accumulated while receiving (address, E/S & data)
+	FctERR err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+	if (err == ERROR_OK)	{ err = OWWrite_byte(pDrv, cmd); }
+	if (err == ERROR_OK)	{ err = OWRead_CRC16(pDrv, tmp, sizeof(tmp), &crc16); }
+	if (err != ERROR_OK)	{ goto ret; }
 
 	const uint32_t	mask_bits = pEEP->props->scratchpad_size - 1U;
 	const size_t	len = (tmp[2] & mask_bits) + 1U;
 
-	UNUSED_RET OWRead(pDrv, pEEP->scratch.pData, len);
-	UNUSED_RET OWRead(pDrv, crc.Byte, sizeof(crc.Byte));
+	err = OWRead_CRC16(pDrv, pEEP->scratch.pData, len, &crc16);
+	if (err == ERROR_OK)	{ err = OWRead(pDrv, crc, sizeof(crc)); }
+	if (err != ERROR_OK)	{ goto ret; }
 
 	pEEP->scratch.ES = tmp[2];
 	pEEP->scratch.nb = len;
 	pEEP->scratch.address = MAKEWORD(tmp[0], tmp[1]);
-	pEEP->scratch.crc = MAKEWORD(crc.Byte[0], crc.Byte[1]);
+	pEEP->scratch.crc = MAKEWORD(crc[0], crc[1]);
+
+	crc16 = ~crc16;
+
+	if (crc16 != pEEP->scratch.crc)
+	{
+		err = ERROR_CRC;
+		OW_STATS_INC(pDrv, crcEEP);
+		OW_TRACE(pDrv, OW_TRACE__CRC, OW_TRACE_CRC__EEP, 0U);
+	}
+
+	ret:
+	return err;
+}
 
-	crc.Word = 0U;
-	OWCompute_DallasCRC16(&crc.Word, &((uint8_t) { OW_EEP__READ_SCRATCHPAD }), 1U);
-	OWCompute_DallasCRC16(&crc.Word, tmp, sizeof(tmp));
-	OWCompute_DallasCRC16(&crc.Word, pEEP->scratch.pData, len);
-	crc.Word = ~crc.Word;
 
-	if (crc.Word != pEEP->scratch.crc) { err = ERROR_CRC; }
+FctERR NONNULL__ OW_EEP_Read_Scratchpad(OW_eep_t * const pEEP)
+{
+	OW_slave_t * const		pSlave = pEEP->slave_inst;
+	uint8_t					attempt = 0U;
+	FctERR					err = ERROR_OK;
+
+	if (!OW_is_enabled(pSlave))		{ err = ERROR_DISABLED; }	// Peripheral disabled
+	if (OW_is_busy(pSlave))			{ err = ERROR_BUSY; }		// Device busy
+	if (!pEEP->doneWrite)			{ err = ERROR_BUSY; }		// Copy in progess
+	if (err != ERROR_OK)			{ goto ret; }
+
+	OW_set_busy(pSlave, true);
+
+	do { err = OW_EEP_Read_Scratchpad_Transaction(pEEP); }
+	while (OW_Retry_Check(pSlave->cfg.bus_inst, err, &attempt));
 
-	err:
 	OW_set_busy(pSlave, false);
 
 	ret:
@@ -124,6 +176,7 @@ FctERR NONNULL__ OW_EEP_Write_Scratchpad(OW_eep_t * const pEEP, const uint8_t *
 {
 	OW_slave_t * const		pSlave = pEEP->slave_inst;
 	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
+	uint8_t					attempt = 0U;
 	FctERR					err = ERROR_OK;
 
 	//if (!OW_is_enabled(pSlave))			{ err = ERROR_DISABLED; }	// Peripheral disabled
@@ -131,9 +184,10 @@ FctERR NONNULL__ OW_EEP_Write_Scratchpad(OW_eep_t * const pEEP, const uint8_t *
 	if (len > pEEP->props->scratchpad_size)	{ err = ERROR_OVERFLOW; }	// Scratchpad overflow
 	if (err != ERROR_OK)					{ goto ret; }
 
-	// TODO: is this really needed? (for now, scratchpad is always read back after writing), still needs to be set if no read back is done (for copy)
+	// Needed for copy when scratchpad is not read back (E/S: ending offset, AA & PF flags cleared by write)
 	pEEP->scratch.address = addr;
 	pEEP->scratch.nb = len;
+	pEEP->scratch.ES = (uint8_t) ((addr + len - 1U) & (pEEP->props->scratchpad_size - 1U));
 
 	// Write scratchpad
 	const uint8_t cmd[3] = { OW_EEP__WRITE_SCRATCHPAD, LOBYTE(addr), HIBYTE(addr) };
@@ -146,30 +200,26 @@ FctERR NONNULL__ OW_EEP_Write_Scratchpad(OW_eep_t * const pEEP, const uint8_t *
 
 	OW_set_busy(pSlave, true);
 
-	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)
+	do
 	{
-		OW_set_busy(pSlave, false);
-		goto ret;
-	}
+		uint8_t CRC_received[2] = { 0 };
 
-	UNUSED_RET OWWrite(pDrv, cmd, sizeof(cmd));
-	UNUSED_RET OWWrite(pDrv, pEEP->scratch.pData, len);
+		err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+		if (err == ERROR_OK)	{ err = OWWrite(pDrv, cmd, sizeof(cmd)); }
+		if (err == ERROR_OK)	{ err = OWWrite(pDrv, pEEP->scratch.pData, len); }
+		if (err == ERROR_OK)	{ err = OWRead(pDrv, CRC_received, sizeof(CRC_received)); }	// Get returned CRC
 
-	// Get returned CRC
-	uint8_t CRC_received[2] = { 0 };
-	UNUSED_RET OWRead(pDrv, CRC_received, sizeof(CRC_received));
+		if ((err == ERROR_OK) && (CRC_data != MAKEWORD(CRC_received[0], CRC_received[1])))
+		{
+			err = ERROR_CRC;
+			OW_STATS_INC(pDrv, crcEEP);
+			OW_TRACE(pDrv, OW_TRACE__CRC, OW_TRACE_CRC__EEP, 0U);
+		}
+	}
+	while (OW_Retry_Check(pDrv, err, &attempt));
 
 	OW_set_busy(pSlave, false);
 
-	if (CRC_data != MAKEWORD(CRC_received[0], CRC_received[1])) { err = ERROR_CRC; }
-	else
-	{
-		err = OW_EEP_Read_Scratchpad(pEEP);
-
-		// TODO: check data & iCRC ?
-	}
-
 	ret:
 	return err;
 }
@@ -179,6 +229,7 @@ FctERR NONNULL__ OW_EEP_Read_Memory(OW_eep_t * const pEEP, uint8_t * pData, cons
 {
 	OW_slave_t * const		pSlave = pEEP->slave_inst;
 	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
+	uint8_t					attempt = 0U;
 	FctERR					err = ERROR_OK;
 
 	if (!OW_is_enabled(pSlave))									{ err = ERROR_DISABLED; }	// Peripheral disabled
@@ -189,14 +240,16 @@ FctERR NONNULL__ OW_EEP_Read_Memory(OW_eep_t * const pEEP, uint8_t * pData, cons
 
 	OW_set_busy(pSlave, true);
 
-	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)	{ goto err; }
-
 	const uint8_t cmd[3] = { OW_EEP__READ_MEMORY, LOBYTE(addr), HIBYTE(addr) };
-	UNUSED_RET OWWrite(pDrv, cmd, sizeof(cmd));
-	UNUSED_RET OWRead(pDrv, pData, len);
 
-	err:
+	do
+	{
+		err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+		if (err == ERROR_OK)	{ err = OWWrite(pDrv, cmd, sizeof(cmd)); }
+		if (err == ERROR_OK)	{ err = OWRead(pDrv, pData, len); }
+	}
+	while (OW_Retry_Check(pDrv, err, &attempt));
+
 	OW_set_busy(pSlave, false);
 
 	ret:
@@ -204,9 +257,330 @@ FctERR NONNULL__ OW_EEP_Read_Memory(OW_eep_t * const pEEP, uint8_t * pData, cons
 }
 
 
-FctERR NONNULL__ OW_EEP_Write_Memory(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len)
+/****************************************************************/
+
+
+/*!\brief OneWire EEPROM device write scratchpad (device specific or generic)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] pData - Pointer to data for transmission
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to transmit
+** \return FctERR - error code
+**/
+__STATIC_INLINE FctERR NONNULL_INLINE__ OW_EEP_Op_Write_Scratchpad(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len)
+{
+	const OW_eep_ops_t * const pOps = pEEP->props->ops;
+
+	return ((pOps != NULL) && (pOps->pfWriteScratchpad != NULL))	? pOps->pfWriteScratchpad(pEEP, pData, addr, len)
+																	: OW_EEP_Write_Scratchpad(pEEP, pData, addr, len);
+}
+
+/*!\brief OneWire EEPROM device read scratchpad (device specific or generic)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code
+**/
+__STATIC_INLINE FctERR NONNULL_INLINE__ OW_EEP_Op_Read_Scratchpad(OW_eep_t * const pEEP)
+{
+	const OW_eep_ops_t * const pOps = pEEP->props->ops;
+
+	return ((pOps != NULL) && (pOps->pfReadScratchpad != NULL)) ? pOps->pfReadScratchpad(pEEP) : OW_EEP_Read_Scratchpad(pEEP);
+}
+
+/*!\brief OneWire EEPROM device copy scratchpad (device specific or generic)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code
+**/
+__STATIC_INLINE FctERR NONNULL_INLINE__ OW_EEP_Op_Copy_Scratchpad(OW_eep_t * const pEEP)
+{
+	const OW_eep_ops_t * const pOps = pEEP->props->ops;
+
+	return ((pOps != NULL) && (pOps->pfCopyScratchpad != NULL)) ? pOps->pfCopyScratchpad(pEEP) : OW_EEP_Copy_Scratchpad(pEEP);
+}
+
+FctERR NONNULL__ OW_EEP_Device_Read_Memory(OW_eep_t * const pEEP, uint8_t * pData, const uint32_t addr, const size_t len)
+{
+	const OW_eep_ops_t * const pOps = pEEP->props->ops;
+
+	return ((pOps != NULL) && (pOps->pfReadMemory != NULL))	? pOps->pfReadMemory(pEEP, pData, addr, len)
+															: OW_EEP_Read_Memory(pEEP, pData, addr, len);
+}
+
+
+/****************************************************************/
+
+
+/*!\brief OneWire EEPROM device streaming read end
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+**/
+__STATIC void NONNULL__ OW_EEP_Read_Stream_End(OW_eep_t * const pEEP)
+{
+	OW_eep_stream_t * const pStream = &pEEP->stream;
+
+	if (pStream->addressed)	{ OW_set_busy(pEEP->slave_inst, false); }	// Device held since read memory command
+
+	pStream->addressed = false;
+	pStream->paused = false;
+	pStream->ongoing = false;
+}
+
+
+FctERR NONNULLX__(1, 4, 6) OW_EEP_Read_Stream_Start(OW_eep_t * const pEEP, const uint32_t addr, const size_t len,
+													uint8_t * pBuf, const size_t chunk_size, const pfOW_eepStreamChunk_t pfChunk, void * const pCtx)
+{
+	OW_eep_stream_t * const	pStream = &pEEP->stream;
+	FctERR					err = ERROR_OK;
+
+	if (!OW_is_enabled(pEEP->slave_inst))						{ err = ERROR_DISABLED; }	// Peripheral disabled
+	if (pStream->ongoing)										{ err = ERROR_BUSY; }		// Stream already ongoing
+	if ((chunk_size == 0U) || (len == 0U))						{ err = ERROR_VALUE; }		// Nothing to read
+	if (addr > pEEP->props->max_read_address)					{ err = ERROR_RANGE; }		// Unknown address
+	if ((addr + len) > (pEEP->props->max_read_address + 1U))	{ err = ERROR_OVERFLOW; }	// Bank overflow
+
+	if (err == ERROR_OK)
+	{
+		pStream->pfChunk = pfChunk;
+		pStream->pCtx = pCtx;
+		pStream->pBuf = pBuf;
+		pStream->chunk_size = chunk_size;
+		pStream->address = addr;
+		pStream->len = len;
+		pStream->addressed = false;
+		pStream->paused = false;
+		pStream->ongoing = true;
+	}
+
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Read_Stream_Handler(OW_eep_t * const pEEP)
+{
+	OW_eep_stream_t * const	pStream = &pEEP->stream;
+	OW_slave_t * const		pSlave = pEEP->slave_inst;
+	const size_t			len = min(pStream->chunk_size, pStream->len);
+	FctERR					err = ERROR_OK;
+
+	if (!pStream->ongoing)	{ goto ret; }
+
+	if (pStream->addressed && (pStream->resetGen != OW_Get_Reset_Gen(pSlave->cfg.bus_inst)))
+	{
+		OW_set_busy(pSlave, false);		// Stream ended by another transaction on bus (reset), device addressed again
+		pStream->addressed = false;
+	}
+
+	if (pStream->paused)								{ err = ERROR_BUSY; }
+	else if (!pStream->addressed && OW_is_busy(pSlave))	{ err = ERROR_BUSY; }	// Device used by another operation, retry later
+	if (err != ERROR_OK)								{ goto ret; }
+
+	if (!pStream->addressed)
+	{
+		// Device addressed for first chunk (or after pause / reset), following chunks continue reading without any command
+		err = OW_EEP_Device_Read_Memory(pEEP, pStream->pBuf, pStream->address, len);
+
+		if (err == ERROR_OK)
+		{
+			OW_set_busy(pSlave, true);
+			pStream->resetGen = OW_Get_Reset_Gen(pSlave->cfg.bus_inst);
+			pStream->addressed = true;
+		}
+	}
+	else
+	{
+		err = OWRead(pSlave->cfg.bus_inst, pStream->pBuf, len);
+	}
+
+	if (err == ERROR_OK)	{ err = pStream->pfChunk(pStream->pCtx, pStream->pBuf, pStream->address, len); }
+
+	if (err == ERROR_OK)
+	{
+		pStream->address += len;
+		pStream->len -= len;
+	}
+
+	if ((err != ERROR_OK) || (pStream->len == 0U))	{ OW_EEP_Read_Stream_End(pEEP); }
+	else											{ err = ERROR_BUSY; }
+
+	ret:
+	return err;
+}
+
+
+FctERR NONNULLX__(1, 4, 6) OW_EEP_Read_Stream(OW_eep_t * const pEEP, const uint32_t addr, const size_t len,
+												uint8_t * pBuf, const size_t chunk_size, const pfOW_eepStreamChunk_t pfChunk, void * const pCtx)
+{
+	FctERR err = OW_EEP_Read_Stream_Start(pEEP, addr, len, pBuf, chunk_size, pfChunk, pCtx);
+
+	if (err == ERROR_OK)
+	{
+		while ((err = OW_EEP_Read_Stream_Handler(pEEP)) == ERROR_BUSY)
+		{
+			if (pEEP->stream.paused)	// Bus requested by another transaction, blocking read given up (chunk context may not outlive the call)
+			{
+				OW_EEP_Read_Stream_Abort(pEEP);
+				break;
+			}
+
+			OW_Watchdog_Refresh();
+		}
+	}
+
+	return err;
+}
+
+
+void NONNULL__ OW_EEP_Read_Stream_Pause(OW_eep_t * const pEEP)
+{
+	OW_eep_stream_t * const pStream = &pEEP->stream;
+
+	if (pStream->ongoing)
+	{
+		if (pStream->addressed)	{ OW_set_busy(pEEP->slave_inst, false); }
+
+		pStream->addressed = false;		// Device addressed again at resume
+		pStream->paused = true;
+	}
+}
+
+
+void NONNULL__ OW_EEP_Read_Stream_Abort(OW_eep_t * const pEEP)
+{
+	if (pEEP->stream.ongoing)	{ OW_EEP_Read_Stream_End(pEEP); }
+}
+
+
+/*!\brief OneWire EEPROM device scratchpad read back verification
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_EEP_Verify_Scratchpad(OW_eep_t * const pEEP)
+{
+	const uint32_t	addr = pEEP->scratch.address;
+	const size_t	len = min(pEEP->scratch.nb, OW_EEP_SCRATCHPAD_MAX_SIZE);
+	uint8_t			expected[OW_EEP_SCRATCHPAD_MAX_SIZE];
+
+	UNUSED_RET memcpy(expected, pEEP->scratch.pData, len);
+
+	FctERR err = OW_EEP_Op_Read_Scratchpad(pEEP);
+
+	if ((err == ERROR_OK) && ((pEEP->scratch.address != addr) || (memcmp(expected, pEEP->scratch.pData, len) != 0)))
+	{
+		err = ERROR_VALUE;
+	}
+
+	return err;
+}
+
+
+/*!\brief OneWire EEPROM device memory read back verification (once row is programmed)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] addr - Row address
+** \return FctERR - error code (ERROR_PROTECT if programmed memory differs from verified scratchpad, e.g. write protected page)
+**/
+__STATIC FctERR NONNULL__ OW_EEP_Verify_Memory(OW_eep_t * const pEEP, const uint32_t addr)
+{
+	const size_t	len = min(pEEP->props->scratchpad_size, OW_EEP_SCRATCHPAD_MAX_SIZE);
+	uint8_t			programmed[OW_EEP_SCRATCHPAD_MAX_SIZE];
+
+	FctERR err = OW_EEP_Device_Read_Memory(pEEP, programmed, addr, len);
+
+	if ((err == ERROR_OK) && (memcmp(programmed, pEEP->scratch.pData, len) != 0))	{ err = ERROR_PROTECT; }
+
+	return err;
+}
+
+
+/*!\brief OneWire EEPROM device write job current row
+** \note Row is read first when partially written (merge), then scratchpad is written, verified and copied
+** \note With differential writes enabled, row is always read first and left untouched if content is unchanged
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_EEP_Write_Row(OW_eep_t * const pEEP)
+{
+	OW_eep_job_t * const	pJob = &pEEP->job;
+	const size_t			row_size = pEEP->props->scratchpad_size;
+	const size_t			write_len = min(row_size - pJob->offset, pJob->len);
+	FctERR					err = ERROR_OK;
+
+	if (pEEP->diffWrite)
+	{
+		err = OW_EEP_Device_Read_Memory(pEEP, pEEP->scratch.pData, pJob->address, row_size);	// Whole row read for comparison (and merge)
+		if (err != ERROR_OK)	{ goto ret; }
+
+		if (memcmp(&pEEP->scratch.pData[pJob->offset], pJob->pData, write_len) == 0)
+		{
+			pEEP->skippedRows++;	// Row content unchanged, no write/copy needed
+			goto next;
+		}
+
+		UNUSED_RET memcpy(&pEEP->scratch.pData[pJob->offset], pJob->pData, write_len);
+	}
+	else if (pJob->offset != 0U)
+	{
+		const size_t read_len = ((write_len + pJob->offset) == row_size) ? pJob->offset : row_size;
+
+		err = OW_EEP_Device_Read_Memory(pEEP, pEEP->scratch.pData, pJob->address, read_len);
+		UNUSED_RET memcpy(&pEEP->scratch.pData[pJob->offset], pJob->pData, write_len);
+	}
+	else if (write_len < row_size)
+	{
+		const size_t read_len = row_size - write_len;
+
+		err = OW_EEP_Device_Read_Memory(pEEP, &pEEP->scratch.pData[write_len], pJob->address + write_len, read_len);
+		UNUSED_RET memcpy(pEEP->scratch.pData, pJob->pData, write_len);
+	}
+	else
+	{
+		UNUSED_RET memcpy(pEEP->scratch.pData, pJob->pData, row_size);
+	}
+
+	if (err != ERROR_OK)	{ goto ret; }
+
+	// Write scratchpad & Check CRC
+	err = OW_EEP_Op_Write_Scratchpad(pEEP, pEEP->scratch.pData, pJob->address, row_size);
+	if (err == ERROR_CRC)	{ pEEP->verifyStats.crc++; }
+	if (err != ERROR_OK)	{ goto ret; }
+
+	// Read scratchpad to see if matching with written values
+	if (pEEP->verify != OW_EEP_VERIFY__CRC)
+	{
+		err = OW_EEP_Verify_Scratchpad(pEEP);
+		if (err != ERROR_OK)
+		{
+			if (err != ERROR_BUSY)	{ pEEP->verifyStats.readback++; }	// Row written again at next call if bus busy
+			goto ret;
+		}
+	}
+
+	// Copy scratchpad
+	err = OW_EEP_Op_Copy_Scratchpad(pEEP);
+	if (err != ERROR_OK)	{ goto ret; }
+
+	pJob->verifyAddr = pJob->address;
+	pJob->verifyRow = (pEEP->verify == OW_EEP_VERIFY__MEMORY);	// Memory checked once programmed
+
+	#if OW_EEP_CACHE
+	if (pJob->address < pEEP->props->mem_size)	// Programmed content may differ from written one (protected page), fetch it again when needed
+	{
+		CLR_BITS(pEEP->cache.pState[pJob->address / row_size], OW_EEP_ROW__VALID);
+	}
+	#endif
+
+	next:
+	pJob->pData += write_len;
+	pJob->len -= write_len;
+	pJob->address += row_size;
+	pJob->offset = 0U;	// Further writes will be aligned
+
+	ret:
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Write_Memory_Async(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len)
 {
 	const OW_slave_t * const	pSlave = pEEP->slave_inst;
+	OW_eep_job_t * const		pJob = &pEEP->job;
 	FctERR						err = ERROR_OK;
 
 	if (!OW_is_enabled(pSlave))									{ err = ERROR_DISABLED; }	// Peripheral disabled
@@ -214,58 +588,247 @@ FctERR NONNULL__ OW_EEP_Write_Memory(OW_eep_t * const pEEP, const uint8_t * pDat
 	if (addr > pEEP->props->max_write_address)					{ err = ERROR_RANGE; }		// Unknown address
 	if ((addr + len) > (pEEP->props->max_write_address + 1U))	{ err = ERROR_OVERFLOW; }	// Bank overflow
 	if (!pEEP->doneWrite)										{ err = ERROR_BUSY; }		// Copy in progess
+	if (pJob->ongoing)											{ err = ERROR_BUSY; }		// Write job in progress
 	if (err != ERROR_OK)										{ goto ret; }
 
-	size_t		data_len = len;
-	size_t		unaligned_len = addr % pEEP->props->scratchpad_size;
-	uint32_t	address = addr - unaligned_len;	// If unaligned write access, adjust address to read aligned bytes first
+	pJob->offset = addr % pEEP->props->scratchpad_size;
+	pJob->address = addr - pJob->offset;	// If unaligned write access, adjust address to read aligned bytes first
+	pJob->pData = pData;
+	pJob->len = len;
+	pJob->ongoing = true;
+#if OW_SLAVE_HISTO
+	pJob->hStart = OW_Timestamp();
+#endif
 
-	while (data_len != 0U)
+	ret:
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Write_Memory_Handler(OW_eep_t * const pEEP)
+{
+	OW_eep_job_t * const	pJob = &pEEP->job;
+	FctERR					err = ERROR_OK;
+
+	if (pJob->ongoing)
 	{
-		while (OW_EEP_WriteCycle_Handler(pEEP) != ERROR_OK)	// Wait for a previous write to complete
-		{
-			OW_Watchdog_Refresh();
-			HAL_Delay(1U);
-		}
+		err = OW_EEP_WriteCycle_Handler(pEEP);	// Wait for previous row programming to complete
+
+		if ((err == ERROR_OK) && OW_is_busy(pEEP->slave_inst))	{ err = ERROR_BUSY; }	// Another transaction ongoing on device
+		if (err != ERROR_OK)									{ goto ret; }
 
-		const size_t write_len = min(pEEP->props->scratchpad_size - unaligned_len, data_len);
+		uint32_t addr = pJob->address;
 
-		if (unaligned_len != 0U)
+		if (pJob->verifyRow)
 		{
-			const size_t read_len = ((write_len + unaligned_len) == pEEP->props->scratchpad_size) ? unaligned_len : pEEP->props->scratchpad_size;
+			addr = pJob->verifyAddr;
+			err = OW_EEP_Verify_Memory(pEEP, addr);
+			if (err != ERROR_BUSY)	{ pJob->verifyRow = false; }	// Verification retried at next call if bus busy
+			if ((err != ERROR_OK) && (err != ERROR_BUSY))	{ pEEP->verifyStats.memory++; }
+		}
 
-			err = OW_EEP_Read_Memory(pEEP, pEEP->scratch.pData, address, read_len);
-			UNUSED_RET memcpy(&pEEP->scratch.pData[unaligned_len], pData, write_len);
-			unaligned_len = 0U;	// Reset unaligned_len, further writes will be aligned
+		if ((err == ERROR_OK) && (pJob->len != 0U))
+		{
+			addr = pJob->address;
+			err = OW_EEP_Write_Row(pEEP);
+			if (err == ERROR_OK)	{ err = ERROR_BUSY; }	// Row programming ongoing
 		}
-		else if (write_len < pEEP->props->scratchpad_size)
+
+		if (err != ERROR_BUSY)	// Job done or failed
 		{
-			const size_t read_len = pEEP->props->scratchpad_size - write_len;
+			pJob->ongoing = false;
+			pJob->verifyRow = false;
+			OW_SLAVE_HISTO_RECORD(pEEP->slave_inst, OW_SLAVE_OP__EEP_WRITE, OW_Elapsed_us(pJob->hStart));
+			OW_EEP_Write_Memory_Done_Callback(pEEP, err, addr);
+		}
+	}
+
+	ret:
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Write_Memory(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len)
+{
+	FctERR err = OW_EEP_Write_Memory_Async(pEEP, pData, addr, len);
 
-			err = OW_EEP_Read_Memory(pEEP, &pEEP->scratch.pData[write_len], address + write_len, read_len);
-			UNUSED_RET memcpy(pEEP->scratch.pData, pData, write_len);
+	if (err == ERROR_OK)
+	{
+		while ((err = OW_EEP_Write_Memory_Handler(pEEP)) == ERROR_BUSY)
+		{
+			OW_Watchdog_Refresh();
+			HAL_Delay(1U);
 		}
-		else
+	}
+
+	return err;
+}
+
+
+__WEAK void NONNULL__ OW_EEP_Write_Memory_Done_Callback(OW_eep_t * const pEEP, const FctERR err, const uint32_t addr)
+{
+	UNUSED(pEEP);
+	UNUSED(err);
+	UNUSED(addr);
+}
+
+
+/****************************************************************/
+#if OW_EEP_CACHE
+
+
+/*!\brief OneWire EEPROM device shadow cache row load
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] row - Row index
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_EEP_Cache_Load_Row(OW_eep_t * const pEEP, const uint32_t row)
+{
+	const size_t	row_size = pEEP->props->scratchpad_size;
+	FctERR			err = ERROR_OK;
+
+	if ((pEEP->cache.pState[row] & OW_EEP_ROW__VALID) != 0U)	{ pEEP->cache.hits++; }
+	else if ((pEEP->cache.pState[row] & OW_EEP_ROW__DIRTY) != 0U)	// Pending write back: cached bytes are the newest content
+	{
+		pEEP->cache.hits++;
+		SET_BITS(pEEP->cache.pState[row], OW_EEP_ROW__VALID);
+	}
+	else
+	{
+		pEEP->cache.misses++;
+
+		err = OW_EEP_Device_Read_Memory(pEEP, &pEEP->cache.pData[row * row_size], row * row_size, row_size);
+
+		if (err == ERROR_OK)	{ SET_BITS(pEEP->cache.pState[row], OW_EEP_ROW__VALID); }
+	}
+
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Cache_Load(OW_eep_t * const pEEP)
+{
+	const uint32_t	rows = pEEP->props->mem_size / pEEP->props->scratchpad_size;
+	FctERR			err = OW_EEP_Device_Read_Memory(pEEP, pEEP->cache.pData, 0U, pEEP->props->mem_size);
+
+	if (err == ERROR_OK)	{ UNUSED_RET memset(pEEP->cache.pState, OW_EEP_ROW__VALID, rows); }
+
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Cache_Read(OW_eep_t * const pEEP, uint8_t * pData, const uint32_t addr, const size_t len)
+{
+	const size_t	row_size = pEEP->props->scratchpad_size;
+	FctERR			err = ERROR_OK;
+
+	if ((addr + len) > pEEP->props->mem_size)	{ err = OW_EEP_Device_Read_Memory(pEEP, pData, addr, len); }	// Not cached
+	else
+	{
+		for (uint32_t row = addr / row_size ; row <= ((addr + len - 1U) / row_size) ; row++)
 		{
-			UNUSED_RET memcpy(pEEP->scratch.pData, pData, pEEP->props->scratchpad_size);
+			err = OW_EEP_Cache_Load_Row(pEEP, row);
+			if (err != ERROR_OK)	{ goto ret; }
 		}
 
-		if (err != ERROR_OK)	{ goto ret; }
+		UNUSED_RET memcpy(pData, &pEEP->cache.pData[addr], len);
+	}
 
-		// Write scratchpad & Check CRC16 or Read scratchpad to see if matching with written values
-		err = OW_EEP_Write_Scratchpad(pEEP, pEEP->scratch.pData, address, pEEP->props->scratchpad_size);
-		if (err != ERROR_OK)	{ goto ret; }
+	ret:
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Cache_Write(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len)
+{
+	const size_t	row_size = pEEP->props->scratchpad_size;
+	uint32_t		address = addr;
+	size_t			data_len = len;
+	FctERR			err = ERROR_OK;
+
+	if ((addr + len) > pEEP->props->mem_size)	{ err = ERROR_RANGE; }	// Not cached area
+	if (err != ERROR_OK)						{ goto ret; }
 
-		// Copy scratchpad
-		err = OW_EEP_Copy_Scratchpad(pEEP);
+	while (data_len != 0U)
+	{
+		const uint32_t	row = address / row_size;
+		const size_t	offset = address % row_size;
+		const size_t	write_len = min(row_size - offset, data_len);
+
+		err = OW_EEP_Cache_Load_Row(pEEP, row);	// Row content needed for partial writes & comparison
 		if (err != ERROR_OK)	{ goto ret; }
 
+		if (memcmp(&pEEP->cache.pData[address], pData, write_len) != 0)
+		{
+			UNUSED_RET memcpy(&pEEP->cache.pData[address], pData, write_len);
+			SET_BITS(pEEP->cache.pState[row], OW_EEP_ROW__DIRTY);
+		}
+
 		pData += write_len;
 		data_len -= write_len;
-		address += pEEP->props->scratchpad_size;
+		address += write_len;
+	}
+
+	ret:
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Cache_Flush_Handler(OW_eep_t * const pEEP)
+{
+	OW_eep_cache_t * const	pCache = &pEEP->cache;
+	const size_t			row_size = pEEP->props->scratchpad_size;
+	const uint32_t			rows = pEEP->props->mem_size / row_size;
+	FctERR					err = ERROR_OK;
+
+	if (pEEP->job.ongoing)
+	{
+		err = OW_EEP_Write_Memory_Handler(pEEP);
+
+		if (err == ERROR_PROTECT)						{ CLR_BITS(pCache->pState[pCache->flushRow], OW_EEP_ROW__DIRTY | OW_EEP_ROW__VALID); }	// Row can't be programmed: dropped, reloaded from device
+		else if ((err != ERROR_OK) && (err != ERROR_BUSY))	{ SET_BITS(pCache->pState[pCache->flushRow], OW_EEP_ROW__DIRTY); }	// Row shall be written back again
+		if (err != ERROR_OK)							{ goto ret; }
+	}
+
+	for (uint32_t row = 0U ; row < rows ; row++)
+	{
+		if ((pCache->pState[row] & OW_EEP_ROW__DIRTY) != 0U)
+		{
+			err = OW_EEP_Write_Memory_Async(pEEP, &pCache->pData[row * row_size], row * row_size, row_size);
+
+			if (err == ERROR_OK)
+			{
+				CLR_BITS(pCache->pState[row], OW_EEP_ROW__DIRTY);	// Cleared at submission, row written again if modified meanwhile
+				pCache->flushRow = row;
+				err = ERROR_BUSY;
+			}
+
+			break;
+		}
 	}
 
 	ret:
 	return err;
 }
 
+
+FctERR NONNULL__ OW_EEP_Cache_Flush(OW_eep_t * const pEEP)
+{
+	FctERR err;
+
+	while ((err = OW_EEP_Cache_Flush_Handler(pEEP)) == ERROR_BUSY)
+	{
+		OW_Watchdog_Refresh();
+		HAL_Delay(1U);
+	}
+
+	return err;
+}
+
+
+void NONNULL__ OW_EEP_Cache_Invalidate(OW_eep_t * const pEEP) {
+	UNUSED_RET memset(pEEP->cache.pState, 0, pEEP->props->mem_size / pEEP->props->scratchpad_size); }
+
+
+#endif
+/****************************************************************/
@@ -17,20 +17,41 @@
 /****************************************************************/
 
 
+#ifndef OW_EEP_CACHE
+//! \note Define OW_EEP_CACHE to 1 to embed a RAM shadow image of memory in each EEPROM device
+#define OW_EEP_CACHE	0		//!< EEPROM shadow cache disabled
+#endif
+
+
 /**********************************/
 /*** Peripheral defaults setter ***/
 /**********************************/
 
-#define OW_EEPROM_SET_DEFAULTS(name, idx)					\
-	name[idx].eep.slave_inst = &name##_hal[idx];			\
-	name[idx].eep.scratch.pData = name[idx].scratch_data;	\
-	name[idx].eep.props = &name##_eep_props;				\
-	name[idx].eep.doneWrite = true;							//!< Macro to set working defaults for peripheral \b name on index \b idx
+#if OW_EEP_CACHE
+#define OW_EEPROM_SET_CACHE(pCpnt)							\
+	(pCpnt)->eep.cache.pData = (pCpnt)->cache_data;			\
+	(pCpnt)->eep.cache.pState = (pCpnt)->cache_state;		//!< Macro to set shadow cache for peripheral instance \b pCpnt
+#else
+#define OW_EEPROM_SET_CACHE(pCpnt)							//!< Macro to set shadow cache for peripheral instance \b pCpnt (cache disabled)
+#endif
+
+#define OW_EEPROM_SET_DEFAULTS(name, pCpnt, pSlave)			\
+	(pCpnt)->eep.slave_inst = (pSlave);						\
+	(pCpnt)->eep.scratch.pData = (pCpnt)->scratch_data;		\
+	(pCpnt)->eep.props = &name##_eep_props;					\
+	OW_EEPROM_SET_CACHE(pCpnt)								\
+	(pCpnt)->eep.doneWrite = true;							//!< Macro to set working defaults for \b name peripheral instance \b pCpnt using \b pSlave slave structure
 
 
 #define OW_EEPROM_OFFSET(name)	OW_PERIPHERAL_DEV_OFFSET(name, eep)		//!< Macro to get eep structure offset in \b name peripheral structure
 
 
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+#define OW_EEP_SCRATCHPAD_MAX_SIZE	32U		//!< Maximum scratchpad size of supported EEPROM devices (verification buffers size)
+
+
 // *****************************************************************************
 // Section: Types
 // *****************************************************************************
@@ -62,17 +83,38 @@ typedef enum PACK__ {
 } OW_eep_pages;
 
 
+typedef struct sOW_eep	OW_eep_t;		//!< Typedef for OW_eep_t used by function pointers included in properties
+
+typedef FctERR (*pfOW_eepReadScratch_t)(OW_eep_t * const pEEP);																//!< EEPROM read scratchpad function typedef
+typedef FctERR (*pfOW_eepWriteScratch_t)(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len);	//!< EEPROM write scratchpad function typedef
+typedef FctERR (*pfOW_eepCopyScratch_t)(OW_eep_t * const pEEP);																//!< EEPROM copy scratchpad function typedef
+typedef FctERR (*pfOW_eepReadMem_t)(OW_eep_t * const pEEP, uint8_t * pData, const uint32_t addr, const size_t len);			//!< EEPROM read memory function typedef
+
+
+/*!\struct OW_eep_ops_t
+** \brief OneWire EEPROM device specific operations (NULL members fall back to generic EEPROM functions)
+**/
+typedef struct {
+	pfOW_eepReadScratch_t	pfReadScratchpad;	//!< Read scratchpad function pointer
+	pfOW_eepWriteScratch_t	pfWriteScratchpad;	//!< Write scratchpad function pointer
+	pfOW_eepCopyScratch_t	pfCopyScratchpad;	//!< Copy scratchpad function pointer
+	pfOW_eepReadMem_t		pfReadMemory;		//!< Read memory function pointer
+} OW_eep_ops_t;
+
+
 /*!\struct OW_eep_props_t
 ** \brief OneWire EEPROM properties type
 **/
 typedef struct {
-	size_t		scratchpad_size;	//!< Scratchpad size (in bytes)
-	size_t		mem_size;			//!< Memory size (in bytes)
-	size_t		page_size;			//!< Page size (in bytes)
-	uint32_t	page_nb;			//!< Number of pages
-	uint32_t	max_write_address;	//!< Maximum write address
-	uint32_t	max_read_address;	//!< Maximum read address
-	uint8_t		write_cycle_time;	//!< Maximum time for a write cycle
+	size_t					scratchpad_size;	//!< Scratchpad size (in bytes)
+	size_t					mem_size;			//!< Memory size (in bytes)
+	size_t					page_size;			//!< Page size (in bytes)
+	uint32_t				page_nb;			//!< Number of pages
+	uint32_t				max_write_address;	//!< Maximum write address
+	uint32_t				max_read_address;	//!< Maximum read address
+	uint8_t					write_cycle_time;	//!< Maximum time for a write cycle
+	bool					copy_status;		//!< Copy completion reported with alternating 0xAA/0x55 pattern while Vcc powered (none of currently supported devices)
+	const OW_eep_ops_t *	ops;				//!< Device specific operations (NULL for generic EEPROM functions)
 } OW_eep_props_t;
 
 
@@ -88,16 +130,114 @@ typedef struct {
 } OW_eep_scratch_t;
 
 
-/*!\struct OW_eep_t
-** \brief OneWire EEPROM configuration type
+/*!\enum OW_eep_verify
+** \brief Write verification levels for eeprom type devices
+**/
+typedef enum PACK__ {
+	OW_EEP_VERIFY__READBACK = 0U,	//!< Scratchpad write CRC check & scratchpad read back compare
+	OW_EEP_VERIFY__CRC,				//!< Scratchpad write CRC check only
+	OW_EEP_VERIFY__MEMORY,			//!< Scratchpad write CRC check, scratchpad read back compare & memory read back compare after copy
+} OW_eep_verify;
+
+
+/*!\struct OW_eep_verify_stats_t
+** \brief OneWire EEPROM write verification statistics (errors caught by each stage)
+**/
+typedef struct {
+	uint32_t				crc;			//!< Scratchpad write CRC errors
+	uint32_t				readback;		//!< Scratchpad read back errors (CRC or content mismatch)
+	uint32_t				memory;			//!< Memory read back errors (content mismatch after copy)
+} OW_eep_verify_stats_t;
+
+
+/*!\enum OW_eep_row_state
+** \brief Shadow cache row state flags
+**/
+typedef enum PACK__ {
+	OW_EEP_ROW__VALID = 0x01U,	//!< Row image matches device memory (or is newer if dirty)
+	OW_EEP_ROW__DIRTY = 0x02U,	//!< Row image modified, not written back to device yet
+} OW_eep_row_state;
+
+
+/*!\struct OW_eep_cache_t
+** \brief OneWire EEPROM shadow cache
+**/
+typedef struct {
+	uint8_t *				pData;			//!< Pointer to memory image (mem_size bytes, defined in device struct)
+	uint8_t *				pState;			//!< Pointer to rows state (mem_size / scratchpad_size elements, defined in device struct)
+	uint32_t				flushRow;		//!< Row being written back
+	uint32_t				hits;			//!< Number of rows read from cache
+	uint32_t				misses;			//!< Number of rows read from device
+} OW_eep_cache_t;
+
+
+/*!\struct OW_eep_job_t
+** \brief OneWire EEPROM asynchronous write job
+**/
+typedef struct {
+	const uint8_t *			pData;			//!< Pointer to remaining data to write
+	size_t					len;			//!< Number of remaining bytes to write
+	uint32_t				address;		//!< Current row address (scratchpad aligned)
+	size_t					offset;			//!< Data offset in current row (unaligned start address)
+	uint32_t				verifyAddr;		//!< Address of row to verify once programmed
+	bool					verifyRow;		//!< Row memory verification pending
+	bool					ongoing;		//!< Job ongoing
+#if OW_SLAVE_HISTO
+	uint32_t				hStart;			//!< Job submission timestamp (latency histogram)
+#endif
+} OW_eep_job_t;
+
+
+/*!\brief EEPROM streaming read chunk delivery function typedef
+** \param[in,out] pCtx - Pointer to user context
+** \param[in] pData - Pointer to chunk data (bounce buffer)
+** \param[in] addr - Chunk start address
+** \param[in] len - Chunk number of bytes
+** \return FctERR - error code (stream aborted if not ERROR_OK)
+**/
+typedef FctERR (*pfOW_eepStreamChunk_t)(void * const pCtx, const uint8_t * pData, const uint32_t addr, const size_t len);
+
+
+/*!\struct OW_eep_stream_t
+** \brief OneWire EEPROM streaming read
 **/
 typedef struct {
+	pfOW_eepStreamChunk_t	pfChunk;		//!< Chunk delivery function pointer
+	void *					pCtx;			//!< Chunk delivery user context
+	uint8_t *				pBuf;			//!< Pointer to bounce buffer
+	size_t					chunk_size;		//!< Chunk size (bounce buffer size)
+	uint32_t				address;		//!< Next chunk address
+	size_t					len;			//!< Number of remaining bytes to read
+	uint32_t				resetGen;		//!< Bus resets generation when device was addressed
+	bool					addressed;		//!< Read memory command issued, device streaming from address
+	bool					paused;			//!< Stream paused (bus released for other transactions)
+	bool					ongoing;		//!< Stream ongoing
+} OW_eep_stream_t;
+
+
+/*!\struct sOW_eep
+** \brief OneWire EEPROM configuration type
+**/
+struct sOW_eep {
 	OW_slave_t *			slave_inst;		//!< Slave structure
 	const OW_eep_props_t *	props;			//!< EEPROM properties
 	OW_eep_scratch_t		scratch;		//!< Scratchpad structure
+	OW_eep_job_t			job;			//!< Asynchronous write job
+	OW_eep_stream_t			stream;			//!< Streaming read
+#if OW_EEP_CACHE
+	OW_eep_cache_t			cache;			//!< Shadow cache
+#endif
 	uint32_t				hStartWrite;	//!< Write time start
+	OW_eep_verify_stats_t	verifyStats;	//!< Write verification statistics
+	OW_eep_verify			verify;			//!< Write verification level
+	uint32_t				skippedRows;	//!< Number of rows left untouched by differential writes
+	uint8_t					tProgLast;		//!< Last observed programming time (in ms)
+	uint8_t					tProgMax;		//!< Maximum observed programming time (in ms)
+	bool					diffWrite;		//!< Differential writes (rows with unchanged content are not written)
+	bool					extPowered;		//!< Device externally powered (user declared, copy status polled instead of strong pull-up)
+	bool					overlap;		//!< Copy overlapped with other devices transactions (no strong pull-up, no status polling)
 	bool					doneWrite;		//!< Write done status
-} OW_eep_t;
+};
 
 
 // *****************************************************************************
@@ -106,6 +246,8 @@ typedef struct {
 
 /*!\brief OneWire EEPROM device write cycle time handler
 ** \note Non blocking mode: start copy, test copy time, release bus
+** \note Copy status is polled on devices declared externally powered (\ref OW_EEP_Set_Ext_Powered) reporting completion,
+**		 bus is released as soon as programming is done
 ** \note Handler shall be called periodically in a main like loop
 ** \param[in,out] pEEP - Pointer to EEPROM device type structure
 ** \return FctERR - error code
@@ -113,6 +255,30 @@ typedef struct {
 FctERR NONNULL__ OW_EEP_WriteCycle_Handler(OW_eep_t * const pEEP);
 
 
+/*!\brief OneWire EEPROM device strong pull-up needed during copy
+** \note Strong pull-up is driven by default, it is only left off for devices declared externally powered (\ref OW_EEP_Set_Ext_Powered)
+**		 when copy status is polled, or when copy is overlapped with other transactions
+** \param[in] pEEP - Pointer to EEPROM device type structure
+** \return true if strong pull-up shall be driven during copy
+**/
+__INLINE bool NONNULL_INLINE__ OW_EEP_Copy_Strong_Pull(const OW_eep_t * const pEEP) {
+	return !pEEP->overlap && (!pEEP->extPowered || !pEEP->props->copy_status); }
+
+/*!\brief OneWire EEPROM device last observed programming time getter
+** \param[in] pEEP - Pointer to EEPROM device type structure
+** \return Last observed programming time (in ms)
+**/
+__INLINE uint8_t NONNULL_INLINE__ OW_EEP_Get_Prog_Time(const OW_eep_t * const pEEP) {
+	return pEEP->tProgLast; }
+
+/*!\brief OneWire EEPROM device maximum observed programming time getter
+** \param[in] pEEP - Pointer to EEPROM device type structure
+** \return Maximum observed programming time (in ms)
+**/
+__INLINE uint8_t NONNULL_INLINE__ OW_EEP_Get_Prog_Time_Max(const OW_eep_t * const pEEP) {
+	return pEEP->tProgMax; }
+
+
 /*!\brief OneWire EEPROM device read scratchpad
 ** \param[in,out] pEEP - Pointer to EEPROM device type structure
 ** \return FctERR - error code
@@ -120,6 +286,7 @@ FctERR NONNULL__ OW_EEP_WriteCycle_Handler(OW_eep_t * const pEEP);
 FctERR NONNULL__ OW_EEP_Read_Scratchpad(OW_eep_t * const pEEP);
 
 /*!\brief OneWire EEPROM device write scratchpad
+** \note Returned CRC16 is checked, scratchpad is not read back (read back depends on verification level when writing memory)
 ** \param[in,out] pEEP - Pointer to EEPROM device type structure
 ** \param[in] pData - Pointer to data for transmission
 ** \param[in] addr - Target memory cell start address
@@ -138,12 +305,147 @@ FctERR NONNULL__ OW_EEP_Write_Scratchpad(OW_eep_t * const pEEP, const uint8_t *
 **/
 FctERR NONNULL__ OW_EEP_Read_Memory(OW_eep_t * const pEEP, uint8_t * pData, const uint32_t addr, const size_t len);
 
+/*!\brief OneWire EEPROM device read from memory using device specific operation (or generic one)
+** \note To be used by generic layers built on top of any EEPROM device
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in,out] pData - Pointer to data for reception
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to receive
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_EEP_Device_Read_Memory(OW_eep_t * const pEEP, uint8_t * pData, const uint32_t addr, const size_t len);
+
+/*!\brief OneWire EEPROM device streaming read start
+** \note A single read memory command is issued for the whole stream, data being delivered chunk by chunk
+**		 from bounce buffer by calls to \ref OW_EEP_Read_Stream_Handler
+** \warning Device streams data as long as no reset occurs on bus: stream shall be paused (\ref OW_EEP_Read_Stream_Pause)
+**			before any other transaction on the same bus, device being addressed again at read memory resume.
+** \note A bus reset occurring between chunks (transaction of another device) is detected by handler through bus resets generation
+**		 (\ref OW_Get_Reset_Gen), device being addressed again from next chunk address.
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] addr - Memory cell start address
+** \param[in] len - Number of data bytes to read
+** \param[in,out] pBuf - Pointer to bounce buffer
+** \param[in] chunk_size - Chunk size (bounce buffer size)
+** \param[in] pfChunk - Chunk delivery function pointer
+** \param[in] pCtx - Chunk delivery user context (may be NULL)
+** \return FctERR - error code
+**/
+FctERR NONNULLX__(1, 4, 6) OW_EEP_Read_Stream_Start(OW_eep_t * const pEEP, const uint32_t addr, const size_t len,
+													uint8_t * pBuf, const size_t chunk_size, const pfOW_eepStreamChunk_t pfChunk, void * const pCtx);
+
+/*!\brief OneWire EEPROM device streaming read handler
+** \note Non blocking mode: reads and delivers one chunk per call (nothing done while paused)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code (ERROR_BUSY while stream is ongoing)
+**/
+FctERR NONNULL__ OW_EEP_Read_Stream_Handler(OW_eep_t * const pEEP);
+
+/*!\brief OneWire EEPROM device streaming read
+** \note Blocking mode: returns once every chunk is delivered
+** \note If stream gets paused (e.g. from interrupt), stream is aborted and ERROR_BUSY is returned (read to be issued again)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] addr - Memory cell start address
+** \param[in] len - Number of data bytes to read
+** \param[in,out] pBuf - Pointer to bounce buffer
+** \param[in] chunk_size - Chunk size (bounce buffer size)
+** \param[in] pfChunk - Chunk delivery function pointer
+** \param[in] pCtx - Chunk delivery user context (may be NULL)
+** \return FctERR - error code
+** \retval ERROR_BUSY - Stream paused before completion (aborted)
+**/
+FctERR NONNULLX__(1, 4, 6) OW_EEP_Read_Stream(OW_eep_t * const pEEP, const uint32_t addr, const size_t len,
+												uint8_t * pBuf, const size_t chunk_size, const pfOW_eepStreamChunk_t pfChunk, void * const pCtx);
+
+/*!\brief OneWire EEPROM device streaming read pause (bus released between chunks)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+**/
+void NONNULL__ OW_EEP_Read_Stream_Pause(OW_eep_t * const pEEP);
+
+/*!\brief OneWire EEPROM device streaming read resume
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+**/
+__INLINE void NONNULL_INLINE__ OW_EEP_Read_Stream_Resume(OW_eep_t * const pEEP) {
+	pEEP->stream.paused = false; }
+
+/*!\brief OneWire EEPROM device streaming read abort
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+**/
+void NONNULL__ OW_EEP_Read_Stream_Abort(OW_eep_t * const pEEP);
+
+/*!\brief OneWire EEPROM device asynchronous write to memory
+** \note Job is split in scratchpad rows (read-merge if partial, write scratchpad, verify, copy), one row being handled
+** 		 each time programming time of previous row elapsed, by calls to \ref OW_EEP_Write_Memory_Handler
+** \warning Data buffer shall remain valid until job completion (reported by \ref OW_EEP_Write_Memory_Done_Callback)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] pData - Pointer to data for transmission
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to transmit
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_EEP_Write_Memory_Async(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len);
+
+/*!\brief OneWire EEPROM device asynchronous write job handler
+** \note Non blocking mode: handles next row once previous row programming time elapsed
+** \note Handler shall be called periodically in a main like loop or from a timer
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code (ERROR_BUSY while job is ongoing)
+**/
+FctERR NONNULL__ OW_EEP_Write_Memory_Handler(OW_eep_t * const pEEP);
+
+/*!\brief OneWire EEPROM device asynchronous write job ongoing getter
+** \param[in] pEEP - Pointer to EEPROM device type structure
+** \return true if write job is ongoing
+**/
+__INLINE bool NONNULL_INLINE__ OW_EEP_Write_Memory_Ongoing(const OW_eep_t * const pEEP) {
+	return pEEP->job.ongoing; }
+
+/*!\brief OneWire EEPROM device write verification level setter
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] level - Write verification level
+**/
+__INLINE void NONNULL_INLINE__ OW_EEP_Set_Verify(OW_eep_t * const pEEP, const OW_eep_verify level) {
+	pEEP->verify = level; }
+
+/*!\brief OneWire EEPROM device write verification statistics getter
+** \param[in] pEEP - Pointer to EEPROM device type structure
+** \return Pointer to write verification statistics
+**/
+__INLINE const OW_eep_verify_stats_t * NONNULL_INLINE__ OW_EEP_Get_Verify_Stats(const OW_eep_t * const pEEP) {
+	return &pEEP->verifyStats; }
+
+/*!\brief OneWire EEPROM device externally powered setter
+** \note Power supply is given by user as parasite only devices (e.g. DS28E07) do not answer read power supply command
+** \note When set, copy completion is polled (if reported by device) without strong pull-up, bus being released as soon as programming is done
+** \note When set, device write jobs may be overlapped with other externally powered devices ones by \ref OW_EEP_Sched_Submit
+** \warning Shall only be set for devices with Vcc pin connected to external supply
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] en - Externally powered flag (default: false, strong pull-up during copy)
+**/
+__INLINE void NONNULL_INLINE__ OW_EEP_Set_Ext_Powered(OW_eep_t * const pEEP, const bool en) {
+	pEEP->extPowered = en; }
+
+/*!\brief OneWire EEPROM device differential writes setter
+** \note When enabled, each targeted row is read before being written, and only rows with changed content are written & copied
+** 		 (saves programming time & endurance when data is mostly unchanged, costs a row read otherwise)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] en - Differential writes enable flag
+**/
+__INLINE void NONNULL_INLINE__ OW_EEP_Set_Diff_Write(OW_eep_t * const pEEP, const bool en) {
+	pEEP->diffWrite = en; }
+
+/*!\brief OneWire EEPROM device differential writes skipped rows getter
+** \param[in] pEEP - Pointer to EEPROM device type structure
+** \return Number of rows left untouched by differential writes
+**/
+__INLINE uint32_t NONNULL_INLINE__ OW_EEP_Get_Skipped_Rows(const OW_eep_t * const pEEP) {
+	return pEEP->skippedRows; }
+
 /*!\brief OneWire EEPROM device write to memory
 ** \note This function allows writing across banks for convenience.
-** 		 Be aware that writing across banks includes programming wait time for each targeted bank (except for single bank or last in the sequence).
-** 		 Non blocking write can be achieved by writing each bank at once manually,
-** 		 after testing return value of \ref OW_EEP_WriteCycle_Handler to ensure eeprom is ready for write operation
-** \note In any case, \ref OW_EEP_WriteCycle_Handler has to be called somewhere in main like loop to release one wire bus after a write operation.
+** 		 Be aware that writing across banks includes programming wait time for each targeted bank.
+** 		 Non blocking write can be achieved using \ref OW_EEP_Write_Memory_Async
+** \note Blocking mode: returns once last row programming time elapsed
 ** \param[in,out] pEEP - Pointer to EEPROM device type structure
 ** \param[in] pData - Pointer to data for transmission
 ** \param[in] addr - Target memory cell start address
@@ -153,6 +455,73 @@ FctERR NONNULL__ OW_EEP_Read_Memory(OW_eep_t * const pEEP, uint8_t * pData, cons
 FctERR NONNULL__ OW_EEP_Write_Memory(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len);
 
 
+#if OW_EEP_CACHE
+/*!\brief OneWire EEPROM device shadow cache bulk load
+** \note Whole memory is read in a single transaction, all rows are marked valid (pending dirty rows are lost)
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_EEP_Cache_Load(OW_eep_t * const pEEP);
+
+/*!\brief OneWire EEPROM device read through shadow cache
+** \note Rows not in cache are read from device (lazy population), others are served from RAM
+** \note Addresses beyond memory (protection & administrative registers) are never cached and always read from device
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in,out] pData - Pointer to data for reception
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to receive
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_EEP_Cache_Read(OW_eep_t * const pEEP, uint8_t * pData, const uint32_t addr, const size_t len);
+
+/*!\brief OneWire EEPROM device write to shadow cache
+** \note Rows with changed content are marked dirty, device is only written by \ref OW_EEP_Cache_Flush or \ref OW_EEP_Cache_Flush_Handler
+** \note Writes beyond memory (protection & administrative registers) shall be done directly with \ref OW_EEP_Write_Memory
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] pData - Pointer to data for transmission
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to transmit
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_EEP_Cache_Write(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len);
+
+/*!\brief OneWire EEPROM device shadow cache write back handler
+** \note Non blocking mode: dirty rows are written back one at a time using asynchronous write job
+** \note Written back rows are invalidated, so that next read reflects actual device content (e.g. write protected or EPROM mode pages)
+** \note With \ref OW_EEP_VERIFY__MEMORY, a row that can't be programmed (write protected page) is marked clean & invalid,
+** 		 ERROR_PROTECT is reported once and write back goes on with remaining dirty rows at next call
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code (ERROR_BUSY while dirty rows remain)
+**/
+FctERR NONNULL__ OW_EEP_Cache_Flush_Handler(OW_eep_t * const pEEP);
+
+/*!\brief OneWire EEPROM device shadow cache write back
+** \note Blocking mode: returns once every dirty row is programmed
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_EEP_Cache_Flush(OW_eep_t * const pEEP);
+
+/*!\brief OneWire EEPROM device shadow cache invalidation
+** \warning Dirty rows not written back are lost
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+**/
+void NONNULL__ OW_EEP_Cache_Invalidate(OW_eep_t * const pEEP);
+#endif
+
+
+/*****************/
+/*** CALLBACKS ***/
+/*****************/
+/*!\brief OneWire EEPROM device write job completion callback
+** \weak Function declared as weak, can be customly implemented in user code
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] err - Job error code
+** \param[in] addr - Address of failing row (or end address when job succeeded)
+**/
+void NONNULL__ OW_EEP_Write_Memory_Done_Callback(OW_eep_t * const pEEP, const FctERR err, const uint32_t addr);
+
+
 /****************************************************************/
 #ifdef __cplusplus
 	}
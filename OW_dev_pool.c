@@ -0,0 +1,141 @@
+/*!\file OW_dev_pool.c
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire devices instances runtime pool
+**/
+/****************************************************************/
+#include <string.h>
+
+#include "sarmfsw.h"
+
+#include "OW_dev_pool.h"
+#include "DS1825.h"
+#include "DS28E07.h"
+#include "MAX31826.h"
+
+#if OW_DEV_POOL
+/****************************************************************/
+
+
+static uint64_t	OW_dev_pool_arena[(OW_DEV_POOL_SIZE + 7U) / 8U] = { 0 };	//!< Device pool arena (8 bytes aligned)
+static size_t	OW_dev_pool_top = 0U;										//!< Device pool arena allocated size (in bytes)
+
+
+/****************************************************************/
+
+
+void * NONNULL__ OW_Dev_Pool_Alloc(OW_dev_pool_class_t * const pClass)
+{
+	const size_t	size = (max(pClass->size, sizeof(OW_dev_pool_node_t)) + OW_DEV_POOL_ALIGN - 1U) & ~(OW_DEV_POOL_ALIGN - 1U);
+	uint8_t *		pBlock = NULL;
+
+	if (pClass->pFree != NULL)	// Released instance reused first
+	{
+		pBlock = (uint8_t *) pClass->pFree;
+		pClass->pFree = pClass->pFree->pNext;
+	}
+	else if (size <= (sizeof(OW_dev_pool_arena) - OW_dev_pool_top))
+	{
+		pBlock = &((uint8_t *) OW_dev_pool_arena)[OW_dev_pool_top];
+		OW_dev_pool_top += size;
+	}
+
+	if (pBlock != NULL)
+	{
+		UNUSED_RET memset(pBlock, 0, size);
+		pClass->nb++;
+	}
+
+	return pBlock;
+}
+
+
+void NONNULL__ OW_Dev_Pool_Free(OW_dev_pool_class_t * const pClass, void * const pBlock)
+{
+	OW_dev_pool_node_t * const pNode = (OW_dev_pool_node_t *) pBlock;
+
+	pNode->pNext = pClass->pFree;
+	pClass->pFree = pNode;
+
+	if (pClass->nb != 0U)	{ pClass->nb--; }
+}
+
+
+size_t OW_Dev_Pool_Get_Free_Size(void)
+{
+	return sizeof(OW_dev_pool_arena) - OW_dev_pool_top;
+}
+
+
+FctERR NONNULL__ OW_Dev_Pool_Populate(OW_DRV * const pOW, const OW_ROM_ID_t ROMId[], const uint8_t nb, uint8_t * const pCreated)
+{
+	FctERR err = ERROR_OK;
+
+#if !defined(OW_DS1825) && !defined(OW_MAX31826) && !defined(OW_DS28E07)
+	UNUSED(pOW);	// No device family handled
+#endif
+
+	*pCreated = 0U;
+
+	for (uintCPU_t i = 0 ; i < nb ; i++)
+	{
+		const OW_ROM_ID_t * const	pROM = &ROMId[i];
+		void *						pCpnt = NULL;
+		FctERR						errDev = ERROR_DEVICE_UNKNOWN;
+
+		// Each X_New declines (without allocation) ROM Ids of other families
+#if defined(OW_DS1825)
+		if (errDev == ERROR_DEVICE_UNKNOWN)
+		{
+			DS1825_t * pDev;
+			errDev = DS1825_New(pOW, pROM, &pDev);
+			pCpnt = pDev;
+		}
+#endif
+#if defined(OW_MAX31826)
+		if (errDev == ERROR_DEVICE_UNKNOWN)
+		{
+			MAX31826_t * pDev;
+			errDev = MAX31826_New(pOW, pROM, &pDev);
+			pCpnt = pDev;
+		}
+#endif
+#if defined(OW_DS28E07)
+		if (errDev == ERROR_DEVICE_UNKNOWN)
+		{
+			DS28E07_t * pDev;
+			errDev = DS28E07_New(pOW, pROM, &pDev);
+			pCpnt = pDev;
+		}
+#endif
+
+		if (errDev == ERROR_OK)
+		{
+			(*pCreated)++;
+			OW_Dev_Pool_New_Callback(pROM, pCpnt);
+		}
+		else if (errDev != ERROR_DEVICE_UNKNOWN)	{ err |= errDev; }	// Unsupported families skipped
+	}
+
+	return err;
+}
+
+
+/****************************************************************/
+
+
+__WEAK void NONNULL__ OW_Dev_Pool_New_Callback(const OW_ROM_ID_t * const pROM, void * const pCpnt)
+{
+	UNUSED(pROM);
+	UNUSED(pCpnt);
+
+	// cppcheck-suppres misra-c2012-3.1
+	/**\code
+	if (pROM->familyCode == DS1825_Get_FamilyCode())	{ UNUSED_RET OW_TEMP_Pipeline_Register(&((DS1825_t *) pCpnt)->temp); }
+	\endcode**/
+}
+
+
+/****************************************************************/
+#endif
+/****************************************************************/
@@ -0,0 +1,123 @@
+/*!\file OW_dev_pool.h
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire devices instances runtime pool
+** \note Enabled defining OW_DEV_POOL to 1: device instances (DS1825, MAX31826, DS28E07) are allocated at runtime
+**		 from a single arena (sized by OW_DEV_POOL_SIZE) instead of OW_<DEV>_NB static arrays.
+** \note Arena is never compacted: each device type keeps released instances in its own free list, reused first at next allocation.
+**/
+/****************************************************************/
+#ifndef OW_DEV_POOL_H__
+	#define OW_DEV_POOL_H__
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+#include "sarmfsw.h"
+
+#include "OW_drv.h"
+
+
+#ifndef OW_DEV_POOL
+//! \note Define OW_DEV_POOL to 1 to allocate device instances from runtime pool (X_New / X_Delete instead of X_Init on OW_X_NB static arrays)
+#define OW_DEV_POOL			0		//!< Device instances runtime pool disabled
+#endif
+
+#ifndef OW_DEV_POOL_SIZE
+#define OW_DEV_POOL_SIZE	2048U	//!< Device pool arena size (in bytes, budget shared by all device types)
+#endif
+
+#if OW_DEV_POOL
+/****************************************************************/
+
+
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+#define OW_DEV_POOL_ALIGN	8U		//!< Device pool blocks alignment (in bytes)
+
+
+// *****************************************************************************
+// Section: Types
+// *****************************************************************************
+/*!\struct OW_dev_pool_node_t
+** \brief Device pool free list node (stored in released block)
+**/
+typedef struct sOW_dev_pool_node {
+	struct sOW_dev_pool_node *	pNext;		//!< Next released block
+} OW_dev_pool_node_t;
+
+
+/*!\struct OW_dev_pool_class_t
+** \brief Device pool class (one per device type)
+**/
+typedef struct {
+	OW_dev_pool_node_t *	pFree;			//!< Released blocks free list
+	size_t					size;			//!< Instance size
+	uint16_t				nb;				//!< Number of allocated instances
+} OW_dev_pool_class_t;
+
+#define OW_DEV_POOL_CLASS(type)		{ NULL, sizeof(type), 0U }		//!< Macro to initialize device pool class of \b type instances
+
+
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+/*!\brief Device pool instance allocation
+** \note Released block of the same class is reused first, arena is used otherwise
+** \param[in,out] pClass - Pointer to device pool class
+** \return Pointer to zeroed instance block (NULL if pool exhausted)
+**/
+void * NONNULL__ OW_Dev_Pool_Alloc(OW_dev_pool_class_t * const pClass);
+
+/*!\brief Device pool instance release
+** \param[in,out] pClass - Pointer to device pool class
+** \param[in,out] pBlock - Pointer to instance block (allocated from \b pClass)
+**/
+void NONNULL__ OW_Dev_Pool_Free(OW_dev_pool_class_t * const pClass, void * const pBlock);
+
+/*!\brief Device pool arena remaining size getter
+** \note Released blocks (kept in classes free lists) are not accounted
+** \return Arena remaining size (in bytes)
+**/
+size_t OW_Dev_Pool_Get_Free_Size(void);
+
+/*!\brief Device pool class allocated instances getter
+** \param[in] pClass - Pointer to device pool class
+** \return Number of allocated instances
+**/
+__INLINE uint16_t NONNULL_INLINE__ OW_Dev_Pool_Get_Nb(const OW_dev_pool_class_t * const pClass) {
+	return pClass->nb; }
+
+
+/*!\brief Device pool populate from enumeration results
+** \note A device instance is created (X_New) for each ROM Id of a supported family, other ROM Ids are skipped
+** \warning ROM Ids already instantiated shall not be given again (pass only newly found devices)
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \param[in] ROMId - ROM Ids array (e.g. filled by \ref OWSearch_All)
+** \param[in] nb - Number of ROM Ids
+** \param[out] pCreated - Pointer to number of created instances
+** \return FctERR - error code (errors of all failing devices creations)
+** \retval ERROR_MEMORY - Pool exhausted for at least one device
+**/
+FctERR NONNULL__ OW_Dev_Pool_Populate(OW_DRV * const pOW, const OW_ROM_ID_t ROMId[], const uint8_t nb, uint8_t * const pCreated);
+
+
+/*!\brief Device pool instance created callback (from \ref OW_Dev_Pool_Populate)
+** \weak Weak implementation (does nothing), to be implemented in user code (e.g. register instance in temperature pipeline)
+** \param[in] pROM - Pointer to device ROM Id (family code giving instance type)
+** \param[in,out] pCpnt - Pointer to created device instance (e.g. DS1825_t *)
+**/
+void NONNULL__ OW_Dev_Pool_New_Callback(const OW_ROM_ID_t * const pROM, void * const pCpnt);
+
+
+/****************************************************************/
+#endif
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif
+/****************************************************************/
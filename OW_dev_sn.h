@@ -21,9 +21,9 @@
 /*** Peripheral defaults setter ***/
 /**********************************/
 
-#define OW_SN_SET_DEFAULTS(name, idx, pROM)					\
-	name[idx].sn.slave_inst = &name##_hal[idx];				\
-	name[idx].sn.serial_number = OWGetSerialNumber(pROM);				//!< Macro to set working defaults for peripheral \b name on index \b idx
+#define OW_SN_SET_DEFAULTS(pCpnt, pSlave, pROM)				\
+	(pCpnt)->sn.slave_inst = (pSlave);						\
+	(pCpnt)->sn.serial_number = OWGetSerialNumber(pROM);				//!< Macro to set working defaults for peripheral instance \b pCpnt using \b pSlave slave structure
 
 
 #define OW_SN_OFFSET(name)	OW_PERIPHERAL_DEV_OFFSET(name, sn)			//!< Macro to get sn structure offset in \b name peripheral structure
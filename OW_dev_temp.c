@@ -18,9 +18,10 @@ FctERR NONNULL__ OW_TEMP_Convert_Handler(OW_temp_t * const pTEMP)
 
 	if (!pTEMP->doneConv)
 	{
-		if (TPSSUP_MS(pTEMP->hStartConv, pTEMP->props->convTimes[pTEMP->resIdx - pTEMP->props->minResIdx] + 1U))	// Add 1ms to max conversion time
+		if (TPSSUP_MS(pTEMP->hStartConv, OW_TEMP_Get_Conversion_Time(pTEMP)))
 		{
 			pTEMP->doneConv = true;
+			OW_SLAVE_HISTO_RECORD(pTEMP->slave_inst, OW_SLAVE_OP__CONVERSION, (HALTicks() - pTEMP->hStartConv) * 1000U);
 
 			OW_StrongPull_Set(pTEMP->slave_inst->cfg.bus_inst, false);
 			OW_set_busy(pTEMP->slave_inst, false);
@@ -57,14 +58,32 @@ FctERR NONNULL__ OWAlarmSearch_All(OW_DRV * const pOW, OW_ROM_ID_t ROMId[], cons
 /****************************************************************/
 
 
-__STATIC_INLINE FctERR NONNULL_INLINE__ OW_TEMP_Check_CRC_Scratchpad(const OW_temp_t * const pTEMP) {
-	return OWCheck_DallasCRC8(pTEMP->scratch.bytes, OW_TEMP_SCRATCHPAD_SIZE - 1, pTEMP->scratch.bytes[OW_TEMP_SCRATCHPAD_SIZE - 1]); }
+/*!\brief OneWire Temperature sensor scratchpad CRC check
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \param[in] crc8 - CRC8 accumulated over whole scratchpad (CRC8 byte included)
+** \return FctERR - error code
+**/
+__STATIC_INLINE FctERR NONNULL_INLINE__ OW_TEMP_Check_CRC_Scratchpad(const OW_temp_t * const pTEMP, const uint8_t crc8)
+{
+	const FctERR err = (crc8 == 0U) ? ERROR_OK : ERROR_CRC;
+
+	UNUSED(pTEMP);	// Only used by statistics & trace (when enabled)
+
+	if (err != ERROR_OK)
+	{
+		OW_STATS_INC(pTEMP->slave_inst->cfg.bus_inst, crcTemp);
+		OW_TRACE(pTEMP->slave_inst->cfg.bus_inst, OW_TRACE__CRC, OW_TRACE_CRC__TEMP, 0U);
+	}
+
+	return err;
+}
 
 
 FctERR NONNULL__ OW_TEMP_Read_Scratchpad(OW_temp_t * const pTEMP)
 {
 	OW_slave_t * const		pSlave = pTEMP->slave_inst;
 	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
+	uint8_t					attempt = 0U;
 	FctERR					err = ERROR_OK;
 
 	if (!OW_is_enabled(pSlave))		{ err = ERROR_DISABLED; }	// Peripheral disabled
@@ -72,17 +91,23 @@ FctERR NONNULL__ OW_TEMP_Read_Scratchpad(OW_temp_t * const pTEMP)
 	if (err != ERROR_OK)			{ goto ret; }
 
 	OW_set_busy(pSlave, true);
+#if OW_SLAVE_HISTO
+	const uint32_t hStart = OW_Timestamp();
+#endif
 
-	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)	{ goto err; }
-
-	UNUSED_RET OWWrite_byte(pDrv, OW_TEMP__READ_SCRATCHPAD);
-	UNUSED_RET OWRead(pDrv, pTEMP->scratch.bytes, OW_TEMP_SCRATCHPAD_SIZE);
+	do
+	{
+		uint8_t crc8 = 0U;
 
-	err = OW_TEMP_Check_CRC_Scratchpad(pTEMP);
+		err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+		if (err == ERROR_OK)	{ err = OWWrite_byte(pDrv, OW_TEMP__READ_SCRATCHPAD); }
+		if (err == ERROR_OK)	{ err = OWRead_CRC8(pDrv, pTEMP->scratch.bytes, OW_TEMP_SCRATCHPAD_SIZE, &crc8); }
+		if (err == ERROR_OK)	{ err = OW_TEMP_Check_CRC_Scratchpad(pTEMP, crc8); }
+	}
+	while (OW_Retry_Check(pDrv, err, &attempt));
 
-	err:
 	OW_set_busy(pSlave, false);
+	OW_SLAVE_HISTO_RECORD(pSlave, OW_SLAVE_OP__READ_SCRATCHPAD, OW_Elapsed_us(hStart));
 
 	ret:
 	return err;
@@ -93,6 +118,7 @@ static FctERR NONNULL__ OW_TEMP_Recall(OW_temp_t * const pTEMP)
 {
 	OW_slave_t * const		pSlave = pTEMP->slave_inst;
 	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
+	uint8_t					attempt = 0U;
 	FctERR					err = ERROR_OK;
 
 	if (!OW_is_enabled(pSlave))		{ err = ERROR_DISABLED; }	// Peripheral disabled
@@ -101,19 +127,20 @@ static FctERR NONNULL__ OW_TEMP_Recall(OW_temp_t * const pTEMP)
 
 	OW_set_busy(pSlave, true);
 
-	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)	{ goto err; }
-
-	UNUSED_RET OWWrite_byte(pSlave->cfg.bus_inst, OW_TEMP__RECALL);
+	do
+	{
+		err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+		if (err == ERROR_OK)	{ err = OWWrite_byte(pDrv, OW_TEMP__RECALL); }
+	}
+	while (OW_Retry_Check(pDrv, err, &attempt));
 
 	uint8_t done = 0;
-	while (done == 0)	// cppcheck-suppress knownConditionTrueFalse ; done is written by OWRead_byte, thus condition is not always true
+	while ((done == 0) && (err == ERROR_OK))	// cppcheck-suppress knownConditionTrueFalse ; done is written by OWRead_byte, thus condition is not always true
 	{
 		OW_Watchdog_Refresh();
-		UNUSED_RET OWRead_byte(pDrv, &done);
+		err = OWRead_byte(pDrv, &done);
 	}
 
-	err:
 	OW_set_busy(pSlave, false);
 
 	ret:
@@ -121,6 +148,26 @@ static FctERR NONNULL__ OW_TEMP_Recall(OW_temp_t * const pTEMP)
 }
 
 
+/*!\brief OneWire Temperature sensor wait for scratchpad copy to EEPROM
+** \param[in,out] pOW - Pointer to OneWire driver instance
+**/
+__STATIC void NONNULL__ OW_TEMP_Copy_Wait(OW_DRV * const pOW)
+{
+	OW_StrongPull_Set(pOW, true);
+
+	// Wait for bytes to be copied in EEP
+	uint8_t cpt = 10U;
+	do
+	{
+		OW_Watchdog_Refresh();
+		HAL_Delay(1U);
+	}
+	while (--cpt != 0);
+
+	OW_StrongPull_Set(pOW, false);
+}
+
+
 static FctERR NONNULL__ OW_TEMP_Copy_Scratchpad(OW_temp_t * const pTEMP)
 {
 	OW_slave_t * const		pSlave = pTEMP->slave_inst;
@@ -133,25 +180,11 @@ static FctERR NONNULL__ OW_TEMP_Copy_Scratchpad(OW_temp_t * const pTEMP)
 
 	OW_set_busy(pSlave, true);
 
+	// Not retried: copy could have started at first attempt
 	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)			{ goto err;	}
-
-	UNUSED_RET OWWrite_byte(pDrv, OW_TEMP__COPY_SCRATCHPAD);
-
-	OW_StrongPull_Set(pTEMP->slave_inst->cfg.bus_inst, true);
-
-	// Wait for bytes to be copied in EEP
-	uint8_t cpt = 10U;
-	do
-	{
-		OW_Watchdog_Refresh();
-		HAL_Delay(1U);
-	}
-	while (--cpt != 0);
+	if (err == ERROR_OK)	{ err = OWWrite_byte(pDrv, OW_TEMP__COPY_SCRATCHPAD); }
+	if (err == ERROR_OK)	{ OW_TEMP_Copy_Wait(pSlave->cfg.bus_inst); }
 
-	OW_StrongPull_Set(pTEMP->slave_inst->cfg.bus_inst, false);
-
-	err:
 	OW_set_busy(pSlave, false);
 
 	ret:
@@ -159,10 +192,15 @@ static FctERR NONNULL__ OW_TEMP_Copy_Scratchpad(OW_temp_t * const pTEMP)
 }
 
 
-FctERR NONNULL__ OW_TEMP_Write_Scratchpad(OW_temp_t * const pTEMP)
+/*!\brief OneWire Temperature sensor device write scratchpad only (no copy to EEPROM)
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_TEMP_Write_Scratchpad_Only(OW_temp_t * const pTEMP)
 {
 	OW_slave_t * const		pSlave = pTEMP->slave_inst;
 	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
+	uint8_t					attempt = 0U;
 	FctERR					err = ERROR_OK;
 
 	if (!OW_is_enabled(pSlave))		{ err = ERROR_DISABLED; }	// Peripheral disabled
@@ -171,14 +209,26 @@ FctERR NONNULL__ OW_TEMP_Write_Scratchpad(OW_temp_t * const pTEMP)
 
 	OW_set_busy(pSlave, true);
 
-	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
-	if (err != ERROR_OK)	{ goto err; }
-
-	UNUSED_RET OWWrite_byte(pDrv, OW_TEMP__WRITE_SCRATCHPAD);
-	UNUSED_RET OWWrite(pDrv, &pTEMP->scratch.bytes[2], pTEMP->props->cfgBytes);
+	do
+	{
+		err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+		if (err == ERROR_OK)	{ err = OWWrite_byte(pDrv, OW_TEMP__WRITE_SCRATCHPAD); }
+		if (err == ERROR_OK)	{ err = OWWrite(pDrv, &pTEMP->scratch.bytes[2], pTEMP->props->cfgBytes); }
+	}
+	while (OW_Retry_Check(pDrv, err, &attempt));
 
 	OW_set_busy(pSlave, false);
 
+	ret:
+	return err;
+}
+
+
+FctERR NONNULL__ OW_TEMP_Write_Scratchpad(OW_temp_t * const pTEMP)
+{
+	FctERR err = OW_TEMP_Write_Scratchpad_Only(pTEMP);
+	if ((err != ERROR_OK) || (pTEMP->writeMode == OW_TEMP__WRITE_VOLATILE))	{ goto ret; }
+
 	err = OW_TEMP_Copy_Scratchpad(pTEMP);
 	if (err != ERROR_OK)	{ goto ret; }
 
@@ -186,10 +236,56 @@ FctERR NONNULL__ OW_TEMP_Write_Scratchpad(OW_temp_t * const pTEMP)
 	if (err != ERROR_OK)	{ goto ret; }
 
 	err = OW_TEMP_Read_Scratchpad(pTEMP);
-	if (err != ERROR_OK)	{ goto ret; }
 
-	err:
-	OW_set_busy(pSlave, false);
+	ret:
+	return err;
+}
+
+
+FctERR NONNULL__ OW_TEMP_Set_Alarm_Window(OW_temp_t * const pTEMP, const int8_t Tl, const int8_t Th)
+{
+	FctERR err = ERROR_NOTAVAIL;
+
+	if (pTEMP->props->cfgBytes >= 2U)	// Th & Tl are the first bytes written to scratchpad
+	{
+		const int8_t Th_bak = pTEMP->scratch.Th;
+		const int8_t Tl_bak = pTEMP->scratch.Tl;
+
+		pTEMP->scratch.Th = Th;
+		pTEMP->scratch.Tl = Tl;
+
+		err = OW_TEMP_Write_Scratchpad_Only(pTEMP);
+
+		if (err != ERROR_OK)
+		{
+			pTEMP->scratch.Th = Th_bak;
+			pTEMP->scratch.Tl = Tl_bak;
+		}
+	}
+
+	return err;
+}
+
+
+FctERR NONNULL__ OW_TEMP_Persist(OW_temp_t * const pTEMP) {
+	return OW_TEMP_Copy_Scratchpad(pTEMP); }
+
+
+FctERR NONNULL__ OW_TEMP_Persist_All(OW_DRV * const pOW)
+{
+	FctERR err = ERROR_OK;
+
+	if (OW_bus_is_busy(pOW))	{ err = ERROR_BUSY; }	// Any bus slave transaction would be disturbed by Skip ROM copy
+	if (err != ERROR_OK)		{ goto ret; }
+
+	err = OWROMCmd_Control_Sequence(pOW, NULL, true);
+
+	if (err == ERROR_OK)
+	{
+		err = OWWrite_byte(pOW, OW_TEMP__COPY_SCRATCHPAD);
+
+		if (err == ERROR_OK)	{ OW_TEMP_Copy_Wait(pOW); }
+	}
 
 	ret:
 	return err;
@@ -210,6 +306,7 @@ FctERR NONNULL__ OW_TEMP_Start_Conversion(OW_temp_t * const pTEMP)
 {
 	OW_slave_t * const		pSlave = pTEMP->slave_inst;
 	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
+	uint8_t					attempt = 0U;
 	FctERR					err = ERROR_OK;
 
 	if (!OW_is_enabled(pSlave))		{ err = ERROR_DISABLED; }	// Peripheral disabled
@@ -218,15 +315,19 @@ FctERR NONNULL__ OW_TEMP_Start_Conversion(OW_temp_t * const pTEMP)
 
 	OW_set_busy(pSlave, true);
 
-	err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+	do
+	{
+		err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+		if (err == ERROR_OK)	{ err = OWWrite_byte(pDrv, OW_TEMP__CONVERT_T); }
+	}
+	while (OW_Retry_Check(pDrv, err, &attempt));
+
 	if (err != ERROR_OK)
 	{
 		OW_set_busy(pSlave, false);
 		goto ret;
 	}
 
-	UNUSED_RET OWWrite_byte(pDrv, OW_TEMP__CONVERT_T);
-
 	OW_StrongPull_Set(pTEMP->slave_inst->cfg.bus_inst, true);
 
 	pTEMP->hStartConv = HALTicks();
@@ -239,16 +340,216 @@ FctERR NONNULL__ OW_TEMP_Start_Conversion(OW_temp_t * const pTEMP)
 }
 
 
+FctERR NONNULL__ OW_TEMP_Start_Conversion_All(OW_DRV * const pOW)
+{
+	FctERR err = OWROMCmd_Control_Sequence(pOW, NULL, true);
+
+	if (err == ERROR_OK)
+	{
+		err = OWWrite_byte(pOW, OW_TEMP__CONVERT_T);
+
+		if (err == ERROR_OK)	{ OW_StrongPull_Set(pOW, true); }
+	}
+
+	return err;
+}
+
+
+void NONNULL__ OW_TEMP_Set_Read_Profile(OW_temp_t * const pTEMP, const OW_temp_read_profile profile, const int16_t maxDelta)
+{
+	pTEMP->readProfile = profile;
+	pTEMP->maxDelta = maxDelta;
+}
+
+
+FctERR NONNULL__ OW_TEMP_Set_Adaptive_Resolution(	OW_temp_t * const pTEMP, const OW_temp_res minRes, const OW_temp_res maxRes,
+													const uint32_t rateLow, const uint32_t rateHigh, const uint8_t hold)
+{
+	OW_temp_adapt_t * const	pAdapt = &pTEMP->adapt;
+	FctERR					err = ERROR_OK;
+
+	if (pTEMP->props->minResIdx == pTEMP->props->maxResIdx)		{ err = ERROR_NOTAVAIL; }	// Fixed resolution device
+	else if (	(minRes < pTEMP->props->minResIdx)
+			||	(maxRes > pTEMP->props->maxResIdx)
+			||	(minRes > maxRes))								{ err = ERROR_RANGE; }		// Resolution out of device bounds
+	else if (rateLow >= rateHigh)								{ err = ERROR_VALUE; }		// No hysteresis
+	else
+	{
+		pAdapt->minResIdx = minRes;
+		pAdapt->maxResIdx = maxRes;
+		pAdapt->rateLow = rateLow;
+		pAdapt->rateHigh = rateHigh;
+		pAdapt->hold = max(1U, hold);
+		pAdapt->fastCnt = 0U;
+		pAdapt->slowCnt = 0U;
+		pAdapt->primed = false;
+		pAdapt->en = true;
+	}
+
+	return err;
+}
+
+
+/*!\brief OneWire Temperature sensor device adaptive resolution policy update
+** \note Called after each successful conversion read, new resolution applies to next conversion
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_TEMP_Adapt_Resolution(OW_temp_t * const pTEMP)
+{
+	OW_temp_adapt_t * const	pAdapt = &pTEMP->adapt;
+	const uint32_t			now = HALTicks();
+	const uint32_t			dt = now - pAdapt->hLast;
+	OW_temp_res				res = pTEMP->resIdx;
+	FctERR					err = ERROR_OK;
+
+	if (pAdapt->primed && (dt != 0U))
+	{
+		const int32_t	delta = (int32_t) pTEMP->tempConv - pAdapt->lastTemp;
+		const uint32_t	rate = ((uint32_t) ((delta < 0) ? -delta : delta) * 1000U) / dt;
+
+		if (rate >= pAdapt->rateHigh)
+		{
+			pAdapt->slowCnt = 0U;
+			if (pAdapt->fastCnt < UINT8_MAX)	{ pAdapt->fastCnt++; }
+		}
+		else if (rate <= pAdapt->rateLow)
+		{
+			pAdapt->fastCnt = 0U;
+			if (pAdapt->slowCnt < UINT8_MAX)	{ pAdapt->slowCnt++; }
+		}
+		else	// Within hysteresis band
+		{
+			pAdapt->fastCnt = 0U;
+			pAdapt->slowCnt = 0U;
+		}
+
+		if ((pAdapt->fastCnt >= pAdapt->hold) && (res > pAdapt->minResIdx))			{ res--; }
+		else if ((pAdapt->slowCnt >= pAdapt->hold) && (res < pAdapt->maxResIdx))	{ res++; }
+		else if (res < pAdapt->minResIdx)											{ res = pAdapt->minResIdx; }	// Resolution set out of policy bounds
+		else if (res > pAdapt->maxResIdx)											{ res = pAdapt->maxResIdx; }
+	}
+
+	pAdapt->lastTemp = pTEMP->tempConv;
+	pAdapt->hLast = now;
+	pAdapt->primed = true;
+
+	if (res != pTEMP->resIdx)
+	{
+		pTEMP->scratch.configuration.Bits.Rx = res;
+
+		err = OW_TEMP_Write_Scratchpad_Only(pTEMP);	// No EEPROM wear
+
+		if (err == ERROR_OK)
+		{
+			pTEMP->resIdx = res;
+			pAdapt->changes++;
+			pAdapt->fastCnt = 0U;
+			pAdapt->slowCnt = 0U;
+		}
+		else	{ pTEMP->scratch.configuration.Bits.Rx = pTEMP->resIdx; }
+	}
+
+	return err;
+}
+
+
+/*!\brief OneWire Temperature sensor device read temperature register only
+** \note Bus is reset after temperature register bytes, remaining scratchpad bytes (and CRC) are not transmitted
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_TEMP_Read_Temperature_Register(OW_temp_t * const pTEMP)
+{
+	OW_slave_t * const		pSlave = pTEMP->slave_inst;
+	const OW_DRV * const	pDrv = pSlave->cfg.bus_inst;
+	uint8_t					attempt = 0U;
+	FctERR					err = ERROR_OK;
+
+	if (!OW_is_enabled(pSlave))		{ err = ERROR_DISABLED; }	// Peripheral disabled
+	if (OW_is_busy(pSlave))			{ err = ERROR_BUSY; }		// Device busy
+	if (err != ERROR_OK)			{ goto ret; }
+
+	OW_set_busy(pSlave, true);
+
+	do
+	{
+		err = OWROMCmd_Control_Sequence(pDrv, &pSlave->cfg.ROM_ID, false);
+		if (err == ERROR_OK)	{ err = OWWrite_byte(pDrv, OW_TEMP__READ_SCRATCHPAD); }
+		if (err == ERROR_OK)	{ err = OWRead(pDrv, pTEMP->scratch.bytes, sizeof(pTEMP->scratch.temp)); }
+		if (err == ERROR_OK)	{ err = OWReset(pDrv); }	// Terminate scratchpad read
+	}
+	while (OW_Retry_Check(pDrv, err, &attempt));
+
+	if (err == ERROR_OK)	{ pTEMP->readStats.shortReads++; }
+
+	OW_set_busy(pSlave, false);
+
+	ret:
+	return err;
+}
+
+
+/*!\brief OneWire Temperature sensor device temperature register plausibility check
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \param[in] temp - Temperature register value
+** \return true if temperature register value is plausible
+**/
+__STATIC bool NONNULL__ OW_TEMP_Check_Plausibility(const OW_temp_t * const pTEMP, const int16_t temp)
+{
+	bool plausible = true;
+
+	if (	(temp == -1)							// Bus stuck high (or no answer from device)
+		||	(temp == OW_TEMP_POR_VALUE))			// Power-on reset value (conversion may not have occurred)
+	{
+		plausible = false;
+	}
+	else if ((pTEMP->maxDelta != 0) && pTEMP->validConv)
+	{
+		const int32_t delta = (int32_t) temp - pTEMP->tempConv;
+
+		if ((delta > pTEMP->maxDelta) || (delta < -pTEMP->maxDelta))	{ plausible = false; }
+	}
+
+	return plausible;
+}
+
+
 FctERR NONNULL__ OW_TEMP_Read_Conversion(OW_temp_t * const pTEMP)
 {
-	FctERR err = OW_TEMP_Read_Scratchpad(pTEMP);
+	FctERR err;
+
+	if (pTEMP->readProfile == OW_TEMP__READ_FULL)
+	{
+		err = OW_TEMP_Read_Scratchpad(pTEMP);
+	}
+	else
+	{
+		err = OW_TEMP_Read_Temperature_Register(pTEMP);
+
+		if (	(err == ERROR_OK)
+			&&	(pTEMP->readProfile == OW_TEMP__READ_TEMP_CHECKED)
+			&&	(!OW_TEMP_Check_Plausibility(pTEMP, MAKEWORD(pTEMP->scratch.bytes[0], pTEMP->scratch.bytes[1]))))
+		{
+			pTEMP->readStats.fallbacks++;
+			err = OW_TEMP_Read_Scratchpad(pTEMP);
+		}
+	}
 
 	if (err == ERROR_OK)
 	{
 		pTEMP->tempConv = MAKEWORD(pTEMP->scratch.bytes[0], pTEMP->scratch.bytes[1]);
 		pTEMP->newData = true;
+		pTEMP->validConv = true;
+
+		// Resolution change failure accounted separately (conversion read status kept)
+		if (pTEMP->adapt.en && (OW_TEMP_Adapt_Resolution(pTEMP) != ERROR_OK))	{ pTEMP->adapt.failures++; }
 	}
 
+	#if OW_TEMP_HISTORY_SIZE
+	if (err != ERROR_BUSY)	{ OW_TEMP_HIST_Push(&pTEMP->hist, pTEMP->tempConv, err); }	// Busy device: no acquisition attempted
+	#endif
+
 	return err;
 }
 
@@ -259,12 +560,13 @@ FctERR NONNULL__ OW_TEMP_Convert(OW_temp_t * const pTEMP)
 
 	if (err == ERROR_OK)
 	{
-		while (TPSINF_MS(pTEMP->hStartConv, pTEMP->props->convTimes[pTEMP->resIdx - pTEMP->props->minResIdx] + 1U))	// Add 1ms to max conversion time
+		while (TPSINF_MS(pTEMP->hStartConv, OW_TEMP_Get_Conversion_Time(pTEMP)))
 		{
 			OW_Watchdog_Refresh();
 		}
 
 		pTEMP->doneConv = true;
+		OW_SLAVE_HISTO_RECORD(pTEMP->slave_inst, OW_SLAVE_OP__CONVERSION, (HALTicks() - pTEMP->hStartConv) * 1000U);
 
 		OW_StrongPull_Set(pTEMP->slave_inst->cfg.bus_inst, false);
 		OW_set_busy(pTEMP->slave_inst, false);
@@ -276,10 +578,53 @@ FctERR NONNULL__ OW_TEMP_Convert(OW_temp_t * const pTEMP)
 }
 
 
+/*!\brief OneWire Temperature sensor device last temperature with undefined bits masked (following resolution)
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \return Temperature register value
+**/
+__STATIC_INLINE int32_t NONNULL_INLINE__ OW_TEMP_Get_Masked_Register(const OW_temp_t * const pTEMP)
+{
+	const uint32_t undef_bits = pTEMP->props->maxResIdx - pTEMP->resIdx;	// 1 undefined lsb per resolution step under maximum resolution
+
+	return (int32_t) pTEMP->tempConv & ~((int32_t) LSHIFT32(1U, undef_bits) - 1);
+}
+
+
+int32_t NONNULL__ OW_TEMP_Get_Temperature_CentiCelsius(OW_temp_t * const pTEMP)
+{
+	const uint8_t frac = pTEMP->props->fracBits;
+
+	pTEMP->newData = false;
+
+	return ((OW_TEMP_Get_Masked_Register(pTEMP) * 100) + (int32_t) (LSHIFT32(1U, frac) >> 1U)) >> frac;	// Rounded to nearest
+}
+
+
+int16_t NONNULL__ OW_TEMP_Get_Temperature_Q8(OW_temp_t * const pTEMP)
+{
+	const uint8_t frac = pTEMP->props->fracBits;
+
+	pTEMP->newData = false;
+
+	return (int16_t) (OW_TEMP_Get_Masked_Register(pTEMP) * (int32_t) LSHIFT32(1U, 8U - frac));
+}
+
+
+void NONNULL__ OW_TEMP_Batch_CentiCelsius(OW_temp_t * const pTEMP[], int16_t out[], const size_t nb)
+{
+	for (size_t i = 0U ; i < nb ; i++)
+	{
+		out[i] = (int16_t) OW_TEMP_Get_Temperature_CentiCelsius(pTEMP[i]);
+	}
+}
+
+
+#if OW_TEMP_FLOAT_API
 float NONNULL__ OW_TEMP_Get_Temperature_Celsius(OW_temp_t * const pTEMP)
 {
 	pTEMP->newData = false;
 
 	return (float) pTEMP->tempConv * pTEMP->props->granularity;
 }
+#endif
 
@@ -14,6 +14,13 @@
 #include "sarmfsw.h"
 
 #include "OW_component.h"
+#include "OW_temp_history.h"
+
+
+#ifndef OW_TEMP_FLOAT_API
+//! \note Define OW_TEMP_FLOAT_API to 0 on MCUs without FPU to get rid of floating point getters (fixed point getters only)
+#define OW_TEMP_FLOAT_API	1		//!< Floating point temperature getters enabled
+#endif
 /****************************************************************/
 
 
@@ -21,10 +28,10 @@
 /*** Peripheral defaults setter ***/
 /**********************************/
 
-#define OW_TEMP_SET_DEFAULTS(name, idx)				\
-	name[idx].temp.slave_inst = &name##_hal[idx];	\
-	name[idx].temp.props = &name##_temp_props;		\
-	name[idx].temp.automatic = true;				//!< Macro to set working defaults for peripheral \b name on index \b idx
+#define OW_TEMP_SET_DEFAULTS(name, pCpnt, pSlave)	\
+	(pCpnt)->temp.slave_inst = (pSlave);			\
+	(pCpnt)->temp.props = &name##_temp_props;		\
+	(pCpnt)->temp.automatic = true;					//!< Macro to set working defaults for \b name peripheral instance \b pCpnt using \b pSlave slave structure
 
 
 #define OW_TEMP_OFFSET(name)	OW_PERIPHERAL_DEV_OFFSET(name, temp)		//!< Macro to get temp structure offset in \b name peripheral structure
@@ -34,6 +41,7 @@
 // Section: Constants
 // *****************************************************************************
 #define OW_TEMP_SCRATCHPAD_SIZE	0x09		//!< Temperature sensor Scratchpad Size
+#define OW_TEMP_POR_VALUE		0x0550		//!< Temperature register power-on reset value (+85°C)
 
 
 // *****************************************************************************
@@ -63,6 +71,25 @@ typedef enum PACK__ {
 } OW_temp_res;
 
 
+/*!\enum OW_temp_read_profile
+** \brief Conversion read profiles for temperature sensor
+**/
+typedef enum PACK__ {
+	OW_TEMP__READ_FULL = 0U,		//!< Whole scratchpad read with CRC8 check
+	OW_TEMP__READ_TEMP_ONLY,		//!< Temperature register only read (bus reset after 2 bytes, no check)
+	OW_TEMP__READ_TEMP_CHECKED,		//!< Temperature register only read with plausibility check (whole scratchpad read when implausible)
+} OW_temp_read_profile;
+
+
+/*!\enum OW_temp_write_mode
+** \brief Scratchpad write modes for temperature sensor
+**/
+typedef enum PACK__ {
+	OW_TEMP__WRITE_PERSIST = 0U,	//!< Scratchpad written, copied to EEPROM, recalled and read back
+	OW_TEMP__WRITE_VOLATILE,		//!< Scratchpad written only (lost on power-up, use \ref OW_TEMP_Persist to store it in EEPROM)
+} OW_temp_write_mode;
+
+
 /*!\union uOW_temp_REG__CFG
 ** \brief Union for configuration register of temperature sensor
 **/
@@ -86,6 +113,7 @@ typedef struct {
 	OW_temp_res			maxResIdx;		//!< Maximum resolution index
 	float				granularity;	//!< Granularity
 	uint8_t				cfgBytes;		//!< Number of configuration bytes written to EEPROM
+	uint8_t				fracBits;		//!< Number of fractional bits of temperature register (granularity = 2^-fracBits)
 } OW_temp_props_t;
 
 
@@ -105,6 +133,36 @@ typedef union PACK__ {
 } OW_temp_scratch_t;
 
 
+/*!\struct OW_temp_read_stats_t
+** \brief OneWire temperature sensor reduced-length reads statistics
+**/
+typedef struct {
+	uint32_t				shortReads;		//!< Number of temperature register only reads
+	uint32_t				fallbacks;		//!< Number of temperature register only reads which needed whole scratchpad read
+} OW_temp_read_stats_t;
+
+
+/*!\struct OW_temp_adapt_t
+** \brief OneWire temperature sensor adaptive resolution policy
+** \note Rates are expressed in raw register units per second (register lsb is granularity at maximum resolution)
+**/
+typedef struct {
+	uint32_t				rateLow;		//!< Rate of change under which resolution is raised
+	uint32_t				rateHigh;		//!< Rate of change above which resolution is lowered
+	uint32_t				hLast;			//!< Previous temperature acquisition time
+	uint32_t				changes;		//!< Number of resolution changes
+	uint32_t				failures;		//!< Number of failed resolution changes (conversion read status unaffected)
+	int16_t					lastTemp;		//!< Previous temperature
+	OW_temp_res				minResIdx;		//!< Minimum resolution used while temperature changes fast
+	OW_temp_res				maxResIdx;		//!< Maximum resolution used while temperature is stable
+	uint8_t					hold;			//!< Number of consecutive conversions beyond threshold before changing resolution
+	uint8_t					fastCnt;		//!< Consecutive conversions above rateHigh
+	uint8_t					slowCnt;		//!< Consecutive conversions under rateLow
+	bool					primed;			//!< Previous temperature available
+	bool					en;				//!< Adaptive resolution enabled
+} OW_temp_adapt_t;
+
+
 /*!\struct OW_temp_t
 ** \brief OneWire Temperature sensor configuration type
 **/
@@ -114,10 +172,19 @@ typedef struct {
 	OW_temp_scratch_t		scratch;		//!< Scratchpad structure
 	OW_temp_res				resIdx;			//!< Resolution index (for arrays)
 	int16_t					tempConv;		//!< Temperature
+	int16_t					maxDelta;		//!< Maximum temperature variation between reads for plausibility check (0: unchecked)
+	OW_temp_read_profile	readProfile;	//!< Conversion read profile
+	OW_temp_write_mode		writeMode;		//!< Scratchpad write mode
+	OW_temp_read_stats_t	readStats;		//!< Reduced-length reads statistics
+	OW_temp_adapt_t			adapt;			//!< Adaptive resolution policy
 	uint32_t				hStartConv;		//!< Conversion time start
 	bool					doneConv;		//!< Conversion done status
 	bool					newData;		//!< New data available since last read
+	bool					validConv;		//!< Temperature read at least once
 	bool					automatic;		//!< Automatically launch conversions
+#if OW_TEMP_HISTORY_SIZE
+	OW_temp_hist_t			hist;			//!< Samples history
+#endif
 } OW_temp_t;
 
 
@@ -160,11 +227,45 @@ __INLINE FctERR NONNULL_INLINE__ OW_TEMP_AlarmSearch_All(OW_temp_t * const pTEMP
 FctERR NONNULL__ OW_TEMP_Read_Scratchpad(OW_temp_t * const pTEMP);
 
 /*!\brief OneWire Temperature sensor device write scratchpad
+** \note Copy to EEPROM depends on write mode set with \ref OW_TEMP_Set_Write_Mode
 ** \param[in,out] pTEMP - Pointer to Temperature device type structure
 ** \return FctERR - error code
 **/
 FctERR NONNULL__ OW_TEMP_Write_Scratchpad(OW_temp_t * const pTEMP);
 
+/*!\brief OneWire Temperature sensor device alarm window setter
+** \note Alarm flag is set by conversions giving temperature lower or equal to \b Tl, or greater or equal to \b Th
+** \note Thresholds are only written to scratchpad (no EEPROM copy), use \ref OW_TEMP_Persist to store them
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \param[in] Tl - Alarm low threshold (in Celsius degrees)
+** \param[in] Th - Alarm high threshold (in Celsius degrees)
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_TEMP_Set_Alarm_Window(OW_temp_t * const pTEMP, const int8_t Tl, const int8_t Th);
+
+/*!\brief OneWire Temperature sensor device write mode setter
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \param[in] mode - Scratchpad write mode
+**/
+__INLINE void NONNULL_INLINE__ OW_TEMP_Set_Write_Mode(OW_temp_t * const pTEMP, const OW_temp_write_mode mode) {
+	pTEMP->writeMode = mode; }
+
+/*!\brief OneWire Temperature sensor device persist scratchpad configuration to EEPROM
+** \note Blocking for EEPROM copy time (10ms)
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_TEMP_Persist(OW_temp_t * const pTEMP);
+
+/*!\brief OneWire Temperature sensor persist scratchpad configuration to EEPROM on every device of the bus
+** \note Skip ROM command is used, all temperature sensors on bus are copying their scratchpad at once
+** \note Blocking for EEPROM copy time (10ms), only performed when no slave registered on bus is busy (\ref OW_bus_is_busy)
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - error code
+** \retval ERROR_BUSY - Transaction ongoing on a bus slave
+**/
+FctERR NONNULL__ OW_TEMP_Persist_All(OW_DRV * const pOW);
+
 
 /*!\brief OneWire Temperature sensor device conversion mode setter (single/automatic)
 ** \param[in,out] pTEMP - Pointer to Temperature device type structure
@@ -173,14 +274,78 @@ FctERR NONNULL__ OW_TEMP_Write_Scratchpad(OW_temp_t * const pTEMP);
 void NONNULL__ OW_TEMP_Set_Conversion_Mode(OW_temp_t * const pTEMP, const bool automatic);
 
 
+/*!\brief OneWire Temperature sensor device conversion read profile setter
+** \note \ref OW_TEMP__READ_TEMP_CHECKED profile falls back to whole scratchpad read on bus stuck high, power-on reset value,
+** 		 or variation greater than \b maxDelta with previous temperature
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \param[in] profile - Conversion read profile
+** \param[in] maxDelta - Maximum temperature variation between reads (raw register units, 0 to disable variation check)
+**/
+void NONNULL__ OW_TEMP_Set_Read_Profile(OW_temp_t * const pTEMP, const OW_temp_read_profile profile, const int16_t maxDelta);
+
+/*!\brief OneWire Temperature sensor device reduced-length reads statistics getter
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \return Pointer to reduced-length reads statistics
+**/
+__INLINE const OW_temp_read_stats_t * NONNULL_INLINE__ OW_TEMP_Get_Read_Stats(const OW_temp_t * const pTEMP) {
+	return &pTEMP->readStats; }
+
+
+/*!\brief OneWire Temperature sensor device adaptive resolution setter
+** \note Resolution is lowered by one step after \b hold consecutive conversions with rate of change above \b rateHigh,
+** 		 and raised by one step after \b hold consecutive conversions with rate of change under \b rateLow.
+** \note Resolution is only written to scratchpad (no EEPROM copy), configuration stored in EEPROM is restored on power-up
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \param[in] minRes - Minimum resolution (used while temperature changes fast)
+** \param[in] maxRes - Maximum resolution (used while temperature is stable)
+** \param[in] rateLow - Rate of change under which resolution is raised (raw register units per second)
+** \param[in] rateHigh - Rate of change above which resolution is lowered (raw register units per second)
+** \param[in] hold - Number of consecutive conversions beyond threshold before changing resolution
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_TEMP_Set_Adaptive_Resolution(	OW_temp_t * const pTEMP, const OW_temp_res minRes, const OW_temp_res maxRes,
+													const uint32_t rateLow, const uint32_t rateHigh, const uint8_t hold);
+
+/*!\brief OneWire Temperature sensor device adaptive resolution stop
+** \note Resolution is kept at its current value
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+**/
+__INLINE void NONNULL_INLINE__ OW_TEMP_Stop_Adaptive_Resolution(OW_temp_t * const pTEMP) {
+	pTEMP->adapt.en = false; }
+
+/*!\brief OneWire Temperature sensor device adaptive resolution changes count getter
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \return Number of resolution changes
+**/
+__INLINE uint32_t NONNULL_INLINE__ OW_TEMP_Get_Adaptive_Changes(const OW_temp_t * const pTEMP) {
+	return pTEMP->adapt.changes; }
+
+/*!\brief OneWire Temperature sensor device adaptive resolution failed changes count getter
+** \note Resolution write failures are not reported by conversion read (change retried at next conversion read)
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \return Number of failed resolution changes
+**/
+__INLINE uint32_t NONNULL_INLINE__ OW_TEMP_Get_Adaptive_Failures(const OW_temp_t * const pTEMP) {
+	return pTEMP->adapt.failures; }
+
+
 /*!\brief OneWire Temperature sensor device start temperature conversion
 ** \param[in,out] pTEMP - Pointer to Temperature device type structure
 ** \return FctERR - error code
 **/
 FctERR NONNULL__ OW_TEMP_Start_Conversion(OW_temp_t * const pTEMP);
 
+/*!\brief OneWire Temperature sensor start temperature conversion on every device of the bus
+** \note Skip ROM command is used, all temperature sensors on bus are converting at once
+** \note Strong pull-up is driven (if any) during conversion, it shall be released by caller once conversion time elapsed
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_TEMP_Start_Conversion_All(OW_DRV * const pOW);
+
 /*!\brief OneWire Temperature sensor device read conversion
 ** \note Reads last converted value, does not launch any conversion
+** \note Scratchpad read length depends on read profile set with \ref OW_TEMP_Set_Read_Profile
 ** \param[in,out] pTEMP - Pointer to Temperature device type structure
 ** \return FctERR - error code
 **/
@@ -194,6 +359,14 @@ FctERR NONNULL__ OW_TEMP_Read_Conversion(OW_temp_t * const pTEMP);
 FctERR NONNULL__ OW_TEMP_Convert(OW_temp_t * const pTEMP);
 
 
+/*!\brief OneWire Temperature sensor device get conversion time
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \return Conversion time following current resolution (in ms, 1ms margin included)
+**/
+__INLINE uint32_t NONNULL_INLINE__ OW_TEMP_Get_Conversion_Time(const OW_temp_t * const pTEMP) {
+	return pTEMP->props->convTimes[pTEMP->resIdx - pTEMP->props->minResIdx] + 1U; }	// Add 1ms to max conversion time
+
+
 /*!\brief OneWire Temperature sensor device get new data flag
 ** \param[in] pTEMP - Pointer to Temperature device type structure
 ** \return True if data not read since previous acquisition
@@ -202,6 +375,65 @@ __INLINE bool NONNULL__ OW_TEMP_Get_New_Data(const OW_temp_t * const pTEMP) {
 	return pTEMP->newData; }
 
 
+#if OW_TEMP_HISTORY_SIZE
+/*!\brief OneWire Temperature sensor device drain samples history
+** \note Samples are pushed by every conversion read (including failed ones, with their status)
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \param[out] samples - Samples output array
+** \param[in] max_nb - Maximum number of samples to drain (most likely number of samples array elements)
+** \return Number of samples drained
+**/
+__INLINE size_t NONNULL_INLINE__ OW_TEMP_History_Drain(OW_temp_t * const pTEMP, OW_temp_sample_t samples[], const size_t max_nb) {
+	return OW_TEMP_HIST_Drain(&pTEMP->hist, samples, max_nb); }
+
+/*!\brief OneWire Temperature sensor device samples statistics snapshot
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \param[out] pStats - Pointer to statistics output
+** \return FctERR - error code (ERROR_BUSY if statistics update ongoing)
+**/
+__INLINE FctERR NONNULL_INLINE__ OW_TEMP_History_Get_Stats(const OW_temp_t * const pTEMP, OW_temp_hist_stats_t * const pStats) {
+	return OW_TEMP_HIST_Get_Stats(&pTEMP->hist, pStats); }
+#endif
+
+
+/*!\brief OneWire Temperature sensor device convert last temperature to centi Celsius degrees
+** \note Integer only computation (no floating point), undefined bits at lower resolutions are masked
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \return Temperature in centi Celsius degrees
+**/
+int32_t NONNULL__ OW_TEMP_Get_Temperature_CentiCelsius(OW_temp_t * const pTEMP);
+
+/*!\brief OneWire Temperature sensor device convert last temperature to centi Fahrenheit degrees
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \return Temperature in centi Fahrenheit degrees
+**/
+__INLINE int32_t NONNULL_INLINE__ OW_TEMP_Get_Temperature_CentiFahrenheit(OW_temp_t * const pTEMP) {
+	return ((OW_TEMP_Get_Temperature_CentiCelsius(pTEMP) * 9) / 5) + 3200; }
+
+/*!\brief OneWire Temperature sensor device convert last temperature to centi Kelvins
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \return Temperature in centi Kelvins
+**/
+__INLINE int32_t NONNULL_INLINE__ OW_TEMP_Get_Temperature_CentiKelvin(OW_temp_t * const pTEMP) {
+	return OW_TEMP_Get_Temperature_CentiCelsius(pTEMP) + 27315; }
+
+/*!\brief OneWire Temperature sensor device convert last temperature to Q8.8 Celsius degrees
+** \note Integer only computation (no floating point), undefined bits at lower resolutions are masked
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \return Temperature in Celsius degrees (Q8.8 format)
+**/
+int16_t NONNULL__ OW_TEMP_Get_Temperature_Q8(OW_temp_t * const pTEMP);
+
+/*!\brief OneWire Temperature sensor devices batch conversion of last temperatures to centi Celsius degrees
+** \note Integer only computation, output array is packed (one int16_t per sensor, in input order)
+** \param[in,out] pTEMP - Array of pointers to Temperature device type structures
+** \param[out] out - Temperatures output array (in centi Celsius degrees)
+** \param[in] nb - Number of sensors to convert
+**/
+void NONNULL__ OW_TEMP_Batch_CentiCelsius(OW_temp_t * const pTEMP[], int16_t out[], const size_t nb);
+
+
+#if OW_TEMP_FLOAT_API
 /*!\brief OneWire Temperature sensor device convert last temperature to Celsius degrees
 ** \param[in,out] pTEMP - Pointer to Temperature device type structure
 ** \return Temperature in Celsius degrees
@@ -221,6 +453,7 @@ __INLINE float NONNULL__ OW_TEMP_Get_Temperature_Fahrenheit(OW_temp_t * const pT
 **/
 __INLINE float NONNULL__ OW_TEMP_Get_Temperature_Kelvin(OW_temp_t * const pTEMP) {
 	return celsius2kelvin(OW_TEMP_Get_Temperature_Celsius(pTEMP)); }
+#endif
 
 
 /****************************************************************/
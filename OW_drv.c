@@ -7,6 +7,7 @@
 #include <string.h>
 
 #include "sarmfsw.h"
+#include "tick_utils.h"
 
 #include "OW_drv.h"
 #include "OW_phy.h"
@@ -17,7 +18,24 @@
 
 
 OW_DRV			OWdrv[OW_BUS_NB] = { 0 };				//!< OWdrv structure
-static uint8_t	OWdrv_device_idx[OW_BUS_NB] = { 0 };	//!< OWdrv current device index (used to create individual mutex index)
+static uint32_t	OWdrv_lock_ids[OW_BUS_NB][OW_LOCK_ID_WORDS] = { 0 };	//!< OWdrv allocated lock identifiers bitmaps
+static uint32_t	OWdrv_reset_gen[OW_BUS_NB] = { 0 };					//!< OWdrv bus resets generation counters
+
+static OW_retry_policy_t	OWdrv_retry_policy[OW_BUS_NB] = { 0 };	//!< OWdrv transactions retry policies
+static OW_retry_stats_t		OWdrv_retry_stats[OW_BUS_NB] = { 0 };	//!< OWdrv transactions retry statistics
+#if OW_DRV_STATS
+static OW_drv_stats_t	OWdrv_stats[OW_BUS_NB] = { 0 };	//!< OWdrv bus statistics
+#endif
+#if OW_SLAVE_HISTO
+static OW_histo_t		OWdrv_search_histo[OW_BUS_NB] = { 0 };	//!< OWdrv search passes latency histograms
+#endif
+#if OW_DRV_TRACE
+OW_trace_t				OWtrace = { 0 };					//!< OWdrv bus trace ring buffer (all buses)
+
+#define OW_TRACE_ERR(pOW, err)	do { if ((err) != ERROR_OK) { OW_TRACE((pOW), OW_TRACE__ERROR, HIBYTE(err), LOBYTE(err)); } } while (0)	//!< Macro to log \b err on \b pOW bus (if any)
+#else
+#define OW_TRACE_ERR(pOW, err)	do {} while (0)	//!< Macro to log \b err on \b pOW bus (trace disabled)
+#endif
 
 
 /****************************************************************/
@@ -33,6 +51,24 @@ FctERR OWInit(OW_Handle_t * const pHandle, const uint8_t idx)
 
 		pOW->phy_inst.inst = pHandle;
 
+		OWdrv_retry_policy[idx].attempts = OW_RETRY_ATTEMPTS;
+		OWdrv_retry_policy[idx].backoff = OW_RETRY_BACKOFF;
+		OWdrv_retry_policy[idx].errors = OW_RETRY_ERRORS;
+#if OW_DRV_STATS
+		pOW->pStats = &OWdrv_stats[idx];
+#endif
+#if OW_DRV_TIMESTAMPS && OW_DRV_CYCCNT
+		SET_BITS(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);	// Enable cycle counter (shared with any other user)
+		SET_BITS(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+#endif
+#if OW_DRV_TRACE
+	#if OW_DRV_CYCCNT
+		OWtrace.clock = SystemCoreClock;
+	#else
+		OWtrace.clock = 1000U;									// HAL ticks (ms)
+	#endif
+#endif
+
 		OWSearch_SetType(pOW, OW__SEARCH_ROM);	// Set default search command
 
 		err = OWInit_phy(idx);
@@ -85,7 +121,13 @@ void OW_StrongPull_Set(OW_DRV * const pOW, const bool en)
 {
 	if ((pOW->StrongPull_cfg.GPIOx != NULL) && (pOW->StrongPull_cfg.GPIO_Pin != 0U))
 	{
+#if OW_DRV_STATS
+		if (en && !pOW->strong_pull_en)			{ pOW->pStats->hStrongPull = HALTicks(); }
+		else if (!en && pOW->strong_pull_en)	{ OW_STATS_ADD(pOW, strongPullTime, HALTicks() - pOW->pStats->hStrongPull); }
+#endif
+
 		pOW->strong_pull_en = en;
+		OW_TRACE(pOW, OW_TRACE__STRONG_PULL, en, 0U);
 		const GPIO_PinState state = (en ? GPIO_PIN_RESET : GPIO_PIN_SET) ^ pOW->StrongPull_cfg.GPIO_Active;
 		const GPIO_HandleTypeDef * const pGPIO = &pOW->StrongPull_cfg;
 		HAL_GPIO_WritePin(pGPIO->GPIOx, pGPIO->GPIO_Pin, state);
@@ -98,9 +140,48 @@ void OW_StrongPull_Set(OW_DRV * const pOW, const bool en)
 
 OW_mutex_t OWInit_Get_Device_Lock_ID(const OW_DRV * const pOW)
 {
-	// 1st mutex ID is reserved for the driver itself
-	const uint8_t tmp = ++OWdrv_device_idx[pOW - OWdrv];
-	return (OW_mutex_t) LSHIFT32(1U, tmp);
+	uint32_t * const	pIDs = OWdrv_lock_ids[pOW - OWdrv];
+	OW_mutex_t			id = OW_LOCK_ID_FREE;
+
+	SET_BITS(pIDs[0], LSHIFT32(1U, OW_LOCK_ID_FREE) | LSHIFT32(1U, OW_DRV_MUTEX));	// Free bus & driver itself identifiers reserved
+
+	for (uintCPU_t i = 0 ; i < OW_LOCK_ID_WORDS ; i++)
+	{
+		if (pIDs[i] != UINT32_MAX)
+		{
+			const uint32_t	lowest = ~pIDs[i] & (pIDs[i] + 1U);	// Lowest free identifier in word
+			uint32_t		bit = 0U;
+
+			while (LSHIFT32(1U, bit) != lowest)	{ bit++; }
+
+			if (((i * 32U) + bit) < OW_LOCK_ID_MAX)
+			{
+				SET_BITS(pIDs[i], lowest);
+				id = (OW_mutex_t) ((i * 32U) + bit);
+			}
+			break;
+		}
+	}
+
+	return id;
+}
+
+
+bool OW_Release_Device_Lock_ID(OW_DRV * const pOW, const OW_mutex_t id)
+{
+	uint32_t * const	pIDs = OWdrv_lock_ids[pOW - OWdrv];
+	const uint32_t		mask = LSHIFT32(1U, id % 32U);
+	bool				ret = false;
+
+	if (	(id > OW_DRV_MUTEX) && (id < OW_LOCK_ID_MAX)
+		&&	((pIDs[id / 32U] & mask) != 0U))
+	{
+		CLR_BITS(pIDs[id / 32U], mask);
+		if (pOW->mutex == id)	{ pOW->mutex = OW_LOCK_ID_FREE; }
+		ret = true;
+	}
+
+	return ret;
 }
 
 
@@ -108,11 +189,17 @@ bool OW_lock_bus(OW_DRV * const pOW, const OW_mutex_t id)
 {
 	bool ret = false;
 
-	if (pOW->mutex == 0U)
+	if (id == OW_LOCK_ID_FREE)	{ /* Not a lock identifier */ }
+	else if (pOW->mutex == OW_LOCK_ID_FREE)
 	{
-		SET_BITS(pOW->mutex, id);
+		pOW->mutex = id;
 		ret = true;
 	}
+	else
+	{
+		OW_STATS_INC(pOW, lockContention);
+		OW_TRACE(pOW, OW_TRACE__LOCK_DENIED, HIBYTE(pOW->mutex), LOBYTE(pOW->mutex));
+	}
 
 	return ret;
 }
@@ -122,9 +209,9 @@ bool OW_unlock_bus(OW_DRV * const pOW, const OW_mutex_t id)
 {
 	bool ret = false;
 
-	if (pOW->mutex == id)
+	if ((id != OW_LOCK_ID_FREE) && (pOW->mutex == id))
 	{
-		CLR_BITS(pOW->mutex, id);
+		pOW->mutex = OW_LOCK_ID_FREE;
 		ret = true;
 	}
 
@@ -132,119 +219,395 @@ bool OW_unlock_bus(OW_DRV * const pOW, const OW_mutex_t id)
 }
 
 
+void NONNULL__ OW_Set_Retry_Policy(const OW_DRV * const pOW, const OW_retry_policy_t * const pPolicy)
+{
+	OWdrv_retry_policy[pOW - OWdrv] = *pPolicy;
+}
+
+
+void NONNULL__ OW_Get_Retry_Stats(const OW_DRV * const pOW, OW_retry_stats_t * const pStats)
+{
+	*pStats = OWdrv_retry_stats[pOW - OWdrv];
+}
+
+
+bool NONNULL__ OW_Retry_Check(const OW_DRV * const pOW, const FctERR err, uint8_t * const pAttempt)
+{
+	const OW_retry_policy_t * const	pPolicy = &OWdrv_retry_policy[pOW - OWdrv];
+	OW_retry_stats_t * const		pStats = &OWdrv_retry_stats[pOW - OWdrv];
+	bool							retry = false;
+
+	if (err == ERROR_OK)
+	{
+		if (*pAttempt != 0U)	{ pStats->recovered++; }
+	}
+	else if ((err & pPolicy->errors) != 0U)
+	{
+		if ((*pAttempt + 1U) < pPolicy->attempts)
+		{
+			const uint32_t slots = LSHIFT32(pPolicy->backoff, *pAttempt);
+
+			if (slots != 0U)	{ Delay_us(slots * OW_SLOT_TIME_US); }	// Let line settle (noise, slave power recovery)
+
+			(*pAttempt)++;
+			pStats->retries++;
+			retry = true;
+		}
+		else if (pPolicy->attempts > 1U)
+		{
+			pStats->exhausted++;
+		}
+	}
+
+	return retry;
+}
+
+
+#if OW_DRV_TIMESTAMPS
+uint32_t OW_Timestamp(void)
+{
+#if OW_DRV_CYCCNT
+	return DWT->CYCCNT;
+#else
+	return HALTicks();
+#endif
+}
+
+
+uint32_t OW_Elapsed_us(const uint32_t hStart)
+{
+#if OW_DRV_CYCCNT
+	return (DWT->CYCCNT - hStart) / (SystemCoreClock / 1000000U);
+#else
+	return (HALTicks() - hStart) * 1000U;
+#endif
+}
+#endif
+
+
+#if OW_SLAVE_HISTO
+void NONNULL__ OW_Histo_Record(OW_histo_t * const pHisto, const uint32_t us)
+{
+	uint32_t idx = 0U;
+
+	for (uint32_t val = us >> 1U ; (val != 0U) && (idx < (OW_HISTO_BUCKETS - 1U)) ; val >>= 1U)	{ idx++; }	// floor(log2(us))
+
+	if (pHisto->buckets[idx] < UINT16_MAX)	{ pHisto->buckets[idx]++; }
+
+	pHisto->count++;
+	pHisto->max = max(pHisto->max, us);
+}
+
+
+uint32_t NONNULL__ OW_Histo_Percentile(const OW_histo_t * const pHisto, const uint8_t pct)
+{
+	uint32_t total = 0U;
+	uint32_t ret = 0U;
+
+	for (uintCPU_t i = 0 ; i < OW_HISTO_BUCKETS ; i++)	{ total += pHisto->buckets[i]; }
+
+	if (total != 0U)
+	{
+		const uint32_t	target = ((total * min(pct, 100U)) + 99U) / 100U;	// Rounded up
+		uint32_t		cumul = 0U;
+
+		for (uintCPU_t i = 0 ; i < OW_HISTO_BUCKETS ; i++)
+		{
+			cumul += pHisto->buckets[i];
+
+			if (cumul >= target)
+			{
+				ret = (i < (OW_HISTO_BUCKETS - 1U)) ? min(LSHIFT32(1U, i + 1U), pHisto->max) : pHisto->max;
+				break;
+			}
+		}
+	}
+
+	return ret;
+}
+
+
+OW_histo_t * NONNULL__ OW_Get_Search_Histo(const OW_DRV * const pOW)
+{
+	return &OWdrv_search_histo[pOW - OWdrv];
+}
+#endif
+
+
+#if OW_DRV_TRACE
+void NONNULL__ OW_Trace_Event(const OW_DRV * const pOW, const OW_trace_type type, const uint8_t arg, const uint8_t val)
+{
+	uint32_t idx;
+
+	diInterrupts();
+	idx = OWtrace.head++;	// Slot reserved
+	enInterrupts();
+
+	OW_trace_evt_t * const pEvt = &OWtrace.events[idx & (OW_DRV_TRACE - 1U)];
+
+	pEvt->ts = OW_Timestamp();
+	pEvt->bus = (uint8_t) (pOW - OWdrv);
+	pEvt->type = type;
+	pEvt->arg = arg;
+	pEvt->val = val;
+}
+
+
+size_t NONNULL__ OW_Trace_Dump(OW_trace_evt_t events[], const size_t max_nb)
+{
+	const uint32_t	head = OWtrace.head;
+	const size_t	nb = min(min((size_t) head, (size_t) OW_DRV_TRACE), max_nb);
+
+	for (size_t i = 0U ; i < nb ; i++)
+	{
+		events[i] = OWtrace.events[(head - nb + i) & (OW_DRV_TRACE - 1U)];
+	}
+
+	return nb;
+}
+
+
+void OW_Trace_Clear(void)
+{
+	OWtrace.head = 0U;
+}
+#endif
+
+
+#if OW_DRV_STATS
+void NONNULL__ OW_Get_Stats(const OW_DRV * const pOW, OW_drv_stats_t * const pStats)
+{
+	UNUSED_RET memcpy(pStats, pOW->pStats, sizeof(OW_drv_stats_t));
+}
+
+
+void NONNULL__ OW_Reset_Stats(const OW_DRV * const pOW)
+{
+	const uint32_t hStrongPull = pOW->pStats->hStrongPull;
+
+	UNUSED_RET memset(pOW->pStats, 0, sizeof(OW_drv_stats_t));
+	pOW->pStats->hStrongPull = hStrongPull;		// Ongoing strong pull-up hold time kept consistent
+}
+#endif
+
+
 /****************************************************************/
 
 
 FctERR NONNULL__ OWWrite_bit(const OW_DRV * const pOW, const uint8_t bit)
 {
+#if defined(OW_PHY_STATIC)
+	const FctERR err = OW_PHY_STATIC_FCT(Write_bit)(pOW, bit);	// Physical layer checked once at bus reset
+#else
 	FctERR err = ERROR_INSTANCE;
 
 	if (pOW->pfWriteBit != NULL)	{ err = pOW->pfWriteBit(pOW, bit); }
+#endif
+
+	OW_STATS_INC(pOW, bitsWritten);
 
 	return err;
 }
 
 
-FctERR NONNULL__ OWWrite_byte(const OW_DRV * const pOW, const uint8_t byte)
+/*!\brief OneWire write byte bits to bus (not traced, strong pull-up not checked)
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[in] byte - Byte to write
+** \return FctERR - Error code
+**/
+__STATIC_INLINE FctERR NONNULL_INLINE__ OWWrite_byte_bits(const OW_DRV * const pOW, const uint8_t byte)
 {
 #if OW_CUSTOM_BYTE_HANDLERS
-	FctERR err = ERROR_OK;
-
-	if (pOW->pfWriteByte == NULL)	{ err = ERROR_INSTANCE; }
-	else if (pOW->strong_pull_en)	{ err = ERROR_BUSY; }
-
-	if (err == ERROR_OK)			{ err = pOW->pfWriteByte(pOW, byte); }
+	FctERR err = ERROR_INSTANCE;
 
-	return err;
+	if (pOW->pfWriteByte != NULL)
+	{
+		err = pOW->pfWriteByte(pOW, byte);
+		OW_STATS_ADD(pOW, bitsWritten, 8U);
+		OW_STATS_INC(pOW, bytesWritten);
+	}
 #else
-	FctERR	err = ERROR_BUSY;
+	FctERR	err = ERROR_OK;
+	uint8_t	data = byte;
 
-	if (!pOW->strong_pull_en)
+	for (size_t i = 8U ; i ; i--)
 	{
-		uint8_t	data = byte;
-		for (size_t i = 8U ; i ; i--)
-		{
-			err = OWWrite_bit(pOW, data & 0x01U);
-			if (err != ERROR_OK)	{ break; }
+		err = OWWrite_bit(pOW, data & 0x01U);
+		if (err != ERROR_OK)	{ break; }
 
-			data >>= 1U;
-		}
+		data >>= 1U;
 	}
 
-	return err;
+	OW_STATS_INC(pOW, bytesWritten);
 #endif
+
+	return err;
+}
+
+
+/*!\brief OneWire write byte to bus (not traced)
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[in] byte - Byte to write
+** \return FctERR - Error code
+**/
+__STATIC FctERR NONNULL__ OWWrite_byte_raw(const OW_DRV * const pOW, const uint8_t byte)
+{
+	return pOW->strong_pull_en ? ERROR_BUSY : OWWrite_byte_bits(pOW, byte);
+}
+
+
+FctERR NONNULL__ OWWrite_byte(const OW_DRV * const pOW, const uint8_t byte)
+{
+	const FctERR err = OWWrite_byte_raw(pOW, byte);
+
+	OW_TRACE(pOW, OW_TRACE__WRITE_BYTE, byte, 0U);
+	OW_TRACE_ERR(pOW, err);
+
+	return err;
 }
 
 
 FctERR NONNULL__ OWWrite(const OW_DRV * const pOW, const uint8_t * const pData, const size_t len)
 {
-	FctERR			err = ERROR_OK;
+	FctERR			err = pOW->strong_pull_en ? ERROR_BUSY : ERROR_OK;	// Strong pull-up checked once for the whole buffer
 	const uint8_t *	pByte = pData;
 
-	for (size_t i = len ; i ; i--)
+	for (size_t i = len ; i && (err == ERROR_OK) ; i--)
 	{
-		err = OWWrite_byte(pOW, *pByte++);
-		if (err != ERROR_OK)	{ break; }
+		err = OWWrite_byte_bits(pOW, *pByte++);
 	}
 
+	OW_TRACE(pOW, OW_TRACE__WRITE, (len != 0U) ? pData[0] : 0U, min(len, UINT8_MAX));
+	OW_TRACE_ERR(pOW, err);
+
 	return err;
 }
 
 
 FctERR NONNULL__ OWRead_bit(const OW_DRV * const pOW, uint8_t * const pBit)
 {
+#if defined(OW_PHY_STATIC)
+	const FctERR err = OW_PHY_STATIC_FCT(Read_bit)(pOW, pBit);	// Physical layer checked once at bus reset
+#else
 	FctERR err = ERROR_INSTANCE;
 
 	if (pOW->pfReadBit != NULL)		{ err = pOW->pfReadBit(pOW, pBit); }
+#endif
+
+	OW_STATS_INC(pOW, bitsRead);
 
 	return err;
 }
 
 
-FctERR NONNULL__ OWRead_byte(const OW_DRV * const pOW, uint8_t * const pByte)
+/*!\brief OneWire read byte bits from bus (not traced, strong pull-up not checked)
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[out] pByte - Pointer to read byte
+** \return FctERR - Error code
+**/
+__STATIC_INLINE FctERR NONNULL_INLINE__ OWRead_byte_bits(const OW_DRV * const pOW, uint8_t * const pByte)
 {
 #if OW_CUSTOM_BYTE_HANDLERS
-	FctERR err = ERROR_OK;
+	FctERR err = ERROR_INSTANCE;
 
-	if (pOW->pfReadByte == NULL)	{ err = ERROR_INSTANCE; }
-	else if (pOW->strong_pull_en)	{ err = ERROR_BUSY; }
+	if (pOW->pfReadByte != NULL)
+	{
+		err = pOW->pfReadByte(pOW, pByte);
+		OW_STATS_ADD(pOW, bitsRead, 8U);
+		OW_STATS_INC(pOW, bytesRead);
+	}
+#else
+	FctERR	err = ERROR_OK;
+	uint8_t	bit;
+
+	*pByte = 0U;
+
+	for (uint8_t mask = 0x01U ; mask ; mask <<= 1U)
+	{
+		err = OWRead_bit(pOW, &bit);
+		if (err != ERROR_OK)	{ break; }
+
+		if (bit != 0U) 			{ *pByte |= mask; }
+	}
 
-	if (err == ERROR_OK)			{ err = pOW->pfReadByte(pOW, pByte); }
+	OW_STATS_INC(pOW, bytesRead);
+#endif
 
 	return err;
-#else
-	FctERR	err = ERROR_BUSY;
-	uint8_t	bit;
+}
 
-	if (!pOW->strong_pull_en)
+
+/*!\brief OneWire read byte from bus (not traced)
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[out] pByte - Pointer to read byte
+** \return FctERR - Error code
+**/
+__STATIC FctERR NONNULL__ OWRead_byte_raw(const OW_DRV * const pOW, uint8_t * const pByte)
+{
+	return pOW->strong_pull_en ? ERROR_BUSY : OWRead_byte_bits(pOW, pByte);
+}
+
+
+FctERR NONNULL__ OWRead_byte(const OW_DRV * const pOW, uint8_t * const pByte)
+{
+	const FctERR err = OWRead_byte_raw(pOW, pByte);
+
+	OW_TRACE(pOW, OW_TRACE__READ_BYTE, *pByte, 0U);
+	OW_TRACE_ERR(pOW, err);
+
+	return err;
+}
+
+
+FctERR NONNULL__ OWRead(const OW_DRV * const pOW, uint8_t * const pData, const size_t len)
+{
+	FctERR		err = pOW->strong_pull_en ? ERROR_BUSY : ERROR_OK;	// Strong pull-up checked once for the whole buffer
+	uint8_t *	pByte = pData;
+
+	for (size_t i = len ; i && (err == ERROR_OK) ; i--)
 	{
-		*pByte = 0U;
+		err = OWRead_byte_bits(pOW, pByte++);
+	}
 
-		for (uint8_t mask = 0x01U ; mask ; mask <<= 1U)
-		{
-			err = OWRead_bit(pOW, &bit);
-			if (err != ERROR_OK)	{ break; }
+	OW_TRACE(pOW, OW_TRACE__READ, (len != 0U) ? pData[0] : 0U, min(len, UINT8_MAX));
+	OW_TRACE_ERR(pOW, err);
 
-			if (bit != 0U) 			{ *pByte |= mask; }
-		}
+	return err;
+}
+
+
+FctERR NONNULL__ OWRead_CRC8(const OW_DRV * const pOW, uint8_t * const pData, const size_t len, uint8_t * const pCRC8)
+{
+	FctERR		err = pOW->strong_pull_en ? ERROR_BUSY : ERROR_OK;	// Strong pull-up checked once for the whole buffer
+	uint8_t *	pByte = pData;
+
+	for (size_t i = len ; i && (err == ERROR_OK) ; i--)
+	{
+		err = OWRead_byte_bits(pOW, pByte);
+		if (err == ERROR_OK)	{ OWCompute_DallasCRC8(pCRC8, pByte++, 1U); }
 	}
 
+	OW_TRACE(pOW, OW_TRACE__READ, (len != 0U) ? pData[0] : 0U, min(len, UINT8_MAX));
+	OW_TRACE_ERR(pOW, err);
+
 	return err;
-#endif
 }
 
 
-FctERR NONNULL__ OWRead(const OW_DRV * const pOW, uint8_t * const pData, const size_t len)
+FctERR NONNULL__ OWRead_CRC16(const OW_DRV * const pOW, uint8_t * const pData, const size_t len, uint16_t * const pCRC16)
 {
-	FctERR		err = ERROR_OK;
+	FctERR		err = pOW->strong_pull_en ? ERROR_BUSY : ERROR_OK;	// Strong pull-up checked once for the whole buffer
 	uint8_t *	pByte = pData;
 
-	for (size_t i = len ; i ; i--)
+	for (size_t i = len ; i && (err == ERROR_OK) ; i--)
 	{
-		err = OWRead_byte(pOW, pByte++);
-		if (err != ERROR_OK)	{ break; }
+		err = OWRead_byte_bits(pOW, pByte);
+		if (err == ERROR_OK)	{ OWCompute_DallasCRC16(pCRC16, pByte++, 1U); }
 	}
 
+	OW_TRACE(pOW, OW_TRACE__READ, (len != 0U) ? pData[0] : 0U, min(len, UINT8_MAX));
+	OW_TRACE_ERR(pOW, err);
+
 	return err;
 }
 
@@ -252,27 +615,50 @@ FctERR NONNULL__ OWRead(const OW_DRV * const pOW, uint8_t * const pData, const s
 /****************************************************************/
 
 
-/*!\brief OneWire bus reset
-** \param[in] pOW - Pointer to OneWire driver instance
-** \return FctERR - Error code
-**/
-__STATIC FctERR NONNULL__ OWReset(const OW_DRV * const pOW)
+FctERR NONNULL__ OWReset(const OW_DRV * const pOW)
 {
 	FctERR err = ERROR_INSTANCE;
 
 	if (pOW->strong_pull_en)		{ err = ERROR_BUSY; }
-	else if (pOW->pfReset != NULL)	{ err = pOW->pfReset(pOW); }
+#if defined(OW_PHY_STATIC)
+	else if (pOW->phy == OW_PHY_STATIC_TYPE)	// Bus physical layer initialized (bits primitives unchecked until next reset)
+	{
+		err = OW_PHY_STATIC_FCT(Reset)(pOW);
+#else
+	else if (pOW->pfReset != NULL)
+	{
+		err = pOW->pfReset(pOW);
+#endif
+
+		OWdrv_reset_gen[pOW - OWdrv]++;	// Ongoing device sessions (e.g. memory streams) ended by reset
+		OW_STATS_INC(pOW, resets);
+		if (err != ERROR_OK)	{ OW_STATS_INC(pOW, presenceFails); }
+
+		OW_TRACE(pOW, OW_TRACE__RESET, err == ERROR_OK, 0U);
+	}
 
 	return err;
 }
 
 
+uint32_t NONNULL__ OW_Get_Reset_Gen(const OW_DRV * const pOW)
+{
+	return OWdrv_reset_gen[pOW - OWdrv];
+}
+
+
 FctERR NONNULL__ OWSelect(const OW_DRV * const pOW, const OW_ROM_ID_t * const pROM)
 {
-	FctERR err;
+	FctERR err = pOW->strong_pull_en ? ERROR_BUSY : ERROR_OK;	// Strong pull-up checked once for the whole sequence
+
+	if (err == ERROR_OK)	{ err = OWWrite_byte_bits(pOW, OW__MATCH_ROM); }
+	for (size_t i = 0U ; (i < sizeof(OW_ROM_ID_t)) && (err == ERROR_OK) ; i++)
+	{
+		err = OWWrite_byte_bits(pOW, pROM->romId[i]);
+	}
 
-	err = OWWrite_byte(pOW, OW__MATCH_ROM);
-	err |= OWWrite(pOW, pROM->romId, sizeof(OW_ROM_ID_t));
+	OW_TRACE(pOW, OW_TRACE__SELECT, pROM->familyCode, pROM->crc);
+	OW_TRACE_ERR(pOW, err);
 
 	return err;
 }
@@ -280,13 +666,23 @@ FctERR NONNULL__ OWSelect(const OW_DRV * const pOW, const OW_ROM_ID_t * const pR
 
 FctERR NONNULL__ OWSkip(const OW_DRV * const pOW)
 {
-	return OWWrite_byte(pOW, OW__SKIP_ROM);
+	const FctERR err = OWWrite_byte_raw(pOW, OW__SKIP_ROM);
+
+	OW_TRACE(pOW, OW_TRACE__ROM_CMD, OW__SKIP_ROM, 0U);
+	OW_TRACE_ERR(pOW, err);
+
+	return err;
 }
 
 
 FctERR NONNULL__ OWResume(const OW_DRV * const pOW)
 {
-	return OWWrite_byte(pOW, OW__RESUME);
+	const FctERR err = OWWrite_byte_raw(pOW, OW__RESUME);
+
+	OW_TRACE(pOW, OW_TRACE__ROM_CMD, OW__RESUME, 0U);
+	OW_TRACE_ERR(pOW, err);
+
+	return err;
 }
 
 
@@ -319,6 +715,9 @@ __STATIC FctERR NONNULLX__(1) OWSearch(OW_DRV * const pOW, OW_ROM_ID_t * const p
 		if (!pOW->search_state.lastDeviceFlag)	// if the last call was not the last one
 		{
 			uint8_t id_bit_number = 1U;
+#if OW_SLAVE_HISTO
+			const uint32_t hStart = OW_Timestamp();
+#endif
 
 			// 1-Wire reset
 			if (OWReset(pOW) != ERROR_OK)
@@ -328,8 +727,11 @@ __STATIC FctERR NONNULLX__(1) OWSearch(OW_DRV * const pOW, OW_ROM_ID_t * const p
 				goto ret;
 			}
 
+			OW_STATS_INC(pOW, searches);
+
 			// issue the search command
-			err = OWWrite_byte(pOW, pOW->search_type);
+			err = OWWrite_byte_bits(pOW, pOW->search_type);	// Strong pull-up already checked
+			OW_TRACE(pOW, OW_TRACE__ROM_CMD, pOW->search_type, 0U);
 			if (err != ERROR_OK)	{ goto ret; }
 
 			// loop to do the search
@@ -421,6 +823,16 @@ __STATIC FctERR NONNULLX__(1) OWSearch(OW_DRV * const pOW, OW_ROM_ID_t * const p
 				if (pOW->search_state.lastDiscrepancy == 0U)	{ pOW->search_state.lastDeviceFlag = true; }
 
 				err = ERROR_OK;
+
+				OW_TRACE(pOW, OW_TRACE__SEARCH, pOW->search_state.ROM_ID.familyCode, pOW->search_state.ROM_ID.crc);
+#if OW_SLAVE_HISTO
+				OW_Histo_Record(OW_Get_Search_Histo(pOW), OW_Elapsed_us(hStart));
+#endif
+			}
+			else if ((id_bit_number >= 65U) && (crc8 != 0U))
+			{
+				OW_STATS_INC(pOW, crcROM);
+				OW_TRACE(pOW, OW_TRACE__CRC, OW_TRACE_CRC__ROM, 0U);
 			}
 		}
 
@@ -523,7 +935,7 @@ void NONNULL__ OWFamilySkipSetup(OW_DRV * const pOW)
 }
 
 
-FctERR NONNULL__ OWROMCmd_Control_Sequence(const OW_DRV * const pOW, const OW_ROM_ID_t * const pROM, const bool broadcast)
+FctERR NONNULLX__(1) OWROMCmd_Control_Sequence(const OW_DRV * const pOW, const OW_ROM_ID_t * const pROM, const bool broadcast)
 {
 	FctERR err = OWReset(pOW);
 
@@ -559,14 +971,17 @@ FctERR NONNULL__ OWCheckPowerSupply(OW_DRV * const pOW)
 
 FctERR NONNULL__ OWRead_ROM_Id(const OW_DRV * const pOW, OW_ROM_ID_t * const pROM)
 {
-	FctERR err = OWReset(pOW);
+	uint8_t	crc8 = 0U;
+	FctERR	err = OWReset(pOW);
 
-	if (err == ERROR_OK)
-	{
-		UNUSED_RET OWWrite_byte(pOW, OW__READ_ROM);
-		UNUSED_RET OWRead(pOW, pROM->romId, OW_ROM_ID_SIZE);
+	if (err == ERROR_OK)	{ err = OWWrite_byte(pOW, OW__READ_ROM); }
+	if (err == ERROR_OK)	{ err = OWRead_CRC8(pOW, pROM->romId, OW_ROM_ID_SIZE, &crc8); }
 
-		err = OWCheck_DallasCRC8(pROM->romId, 7, pROM->romId[7]);
+	if ((err == ERROR_OK) && (crc8 != 0U))	// CRC8 accumulated over ROM Id including its CRC8
+	{
+		err = ERROR_CRC;
+		OW_STATS_INC(pOW, crcROM);
+		OW_TRACE(pOW, OW_TRACE__CRC, OW_TRACE_CRC__ROM, 0U);
 	}
 
 	return err;
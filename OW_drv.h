@@ -11,6 +11,7 @@
 	extern "C" {
 #endif
 
+#include <string.h>
 #include "sarmfsw.h"
 
 #include "OW_rom_id.h"
@@ -26,12 +27,118 @@
 #ifndef	OW_CUSTOM_BYTE_HANDLERS
 #define OW_CUSTOM_BYTE_HANDLERS	0	//!< Custom Byte Transmit/Receive disabled (using common global function instead)
 #endif
+
+#ifndef OW_DRV_TRACE
+//! \note Define OW_DRV_TRACE (power of 2) to log bus events in trace ring buffer (decoded on host with tools/OW_trace_decode.py)
+#define OW_DRV_TRACE			0U	//!< Number of events in bus trace ring buffer (0: disabled)
+#endif
+
+#if (OW_DRV_TRACE & (OW_DRV_TRACE - 1U))
+#error "OW_DRV_TRACE shall be a power of 2"
+#endif
+
+#ifndef OW_DRV_STATS
+//! \note Define OW_DRV_STATS to 1 to accumulate bus statistics (counters & strong pull-up hold time) in each OneWire driver instance
+#define OW_DRV_STATS			0	//!< Bus statistics disabled
+#endif
+
+#ifndef OW_SLAVE_HISTO
+//! \note Define OW_SLAVE_HISTO to 1 to record latency histograms of each slave operation type (and of search passes on each bus)
+#define OW_SLAVE_HISTO			0	//!< Latency histograms disabled
+#endif
+
+#ifndef OW_HISTO_BUCKETS
+//! \note Default covers up to ~2s latencies (conversions up to 750ms, EEPROM write jobs), last bucket starting at 2^(OW_HISTO_BUCKETS-1) us
+#define OW_HISTO_BUCKETS		22U	//!< Number of latency histograms buckets (bucket i: 2^i to 2^(i+1) us, last one unbounded)
+#endif
+
+#if (OW_HISTO_BUCKETS < 2U) || (OW_HISTO_BUCKETS > 32U)
+#error "OW_HISTO_BUCKETS shall be in range 2-32"
+#endif
+
+#ifndef OW_LOCK_ID_MAX
+#define OW_LOCK_ID_MAX			256U	//!< Number of bus lock identifiers on each bus (free & driver identifiers included, up to 65535)
+#endif
+
+#if (OW_LOCK_ID_MAX < 2U) || (OW_LOCK_ID_MAX > 65535U)
+#error "OW_LOCK_ID_MAX shall be in range 2-65535"
+#endif
+
+#ifndef OW_RETRY_ATTEMPTS
+#define OW_RETRY_ATTEMPTS		1U							//!< Default maximum number of attempts for each transaction (1: no retry, enabled per bus with \ref OW_Set_Retry_Policy)
+#endif
+
+#ifndef OW_RETRY_BACKOFF
+#define OW_RETRY_BACKOFF		8U							//!< Default back-off before first retry (in bit slots, doubled at each retry)
+#endif
+
+#ifndef OW_RETRY_ERRORS
+#define OW_RETRY_ERRORS			(ERROR_CRC | ERROR_BUSOFF)	//!< Default retryable errors (CRC failures & missing presence pulse)
+#endif
+
+#ifndef OW_BENCH
+//! \note Define OW_BENCH to 1 to build OW_bench micro-benchmark suite (CRC, search on simulated bus, conversions)
+#define OW_BENCH				0	//!< Micro-benchmark suite disabled
+#endif
+
+#ifndef OW_PHY_STATIC
+//! \note Define OW_PHY_STATIC to GPIO or UART when all buses use the same physical peripheral type:
+//!		  bus primitives are then statically bound to this physical layer (no function pointer dispatch for each bit)
+//#define OW_PHY_STATIC			GPIO	//!< Bus primitives statically bound to physical layer (undefined: dispatch through function pointers)
+#endif
+
+#if defined(OW_PHY_STATIC)
+#define OW_PHY_STATIC_CAT(phy, sym)	OW_##phy##_##sym							//!< Physical layer symbol concatenation
+#define OW_PHY_STATIC_SYM(phy, sym)	OW_PHY_STATIC_CAT(phy, sym)					//!< Physical layer symbol (after \b phy expansion)
+#define OW_PHY_STATIC_FCT(fct)		OW_PHY_STATIC_SYM(OW_PHY_STATIC, fct)		//!< Statically bound physical layer function
+#define OW_PHY_STATIC_TYPE			OW_PHY_STATIC_SYM(PHY, OW_PHY_STATIC)		//!< Statically bound physical peripheral type (\ref OWPhy)
+#endif
+
+#define OW_DRV_TIMESTAMPS		(OW_DRV_TRACE || OW_SLAVE_HISTO || OW_BENCH)	//!< Timestamps needed by trace, latency histograms or benchmarks
+
+#ifndef OW_DRV_CYCCNT
+#if defined(DWT)
+#define OW_DRV_CYCCNT			1	//!< Timestamps from DWT cycle counter
+#else
+#define OW_DRV_CYCCNT			0	//!< Timestamps from HAL ticks (no DWT on core)
+#endif
+#endif
 /****************************************************************/
 
 
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+#define OW_SLOT_TIME_US			70U		//!< Standard speed time slot duration (in us)
+#define OW_RESET_TIME_US		960U	//!< Standard speed reset & presence detect duration (in us)
+
+#define OW_LOCK_ID_FREE			0U		//!< Bus lock identifier of free bus (never allocated to a device)
+#define OW_LOCK_ID_WORDS		((OW_LOCK_ID_MAX + 31U) / 32U)	//!< Number of words of bus lock identifiers allocation bitmap
+
+
 // *****************************************************************************
 // Section: Types
 // *****************************************************************************
+/*!\struct OW_retry_policy_t
+** \brief OneWire bus transactions retry policy
+**/
+typedef struct {
+	uint8_t			attempts;					//!< Maximum number of attempts for each transaction (0 or 1: no retry)
+	uint8_t			backoff;					//!< Back-off before first retry (in bit slots, doubled at each retry)
+	FctERR			errors;						//!< Retryable errors (bit mask of error codes)
+} OW_retry_policy_t;
+
+
+/*!\struct OW_retry_stats_t
+** \brief OneWire bus transactions retry statistics
+**/
+typedef struct {
+	uint32_t		retries;					//!< Number of retries
+	uint32_t		recovered;					//!< Number of transactions succeeding after retry
+	uint32_t		exhausted;					//!< Number of transactions failing after all attempts
+} OW_retry_stats_t;
+
+
 /*!\struct OWSearch_State_t
 ** \brief OneWire Search State struct
 **/
@@ -42,7 +149,102 @@ typedef struct {
 	bool			lastDeviceFlag;				//!< Last device found flag
 } OWSearch_State_t;
 
-typedef uint32_t		OW_mutex_t;		//!< Typedef for mutual exclusion variable
+/*!\struct OW_drv_stats_t
+** \brief OneWire bus statistics
+**/
+typedef struct {
+	uint32_t		resets;						//!< Number of bus resets
+	uint32_t		presenceFails;				//!< Number of bus resets without presence pulse
+	uint32_t		bitsWritten;				//!< Number of write time slots
+	uint32_t		bitsRead;					//!< Number of read time slots
+	uint32_t		bytesWritten;				//!< Number of bytes written
+	uint32_t		bytesRead;					//!< Number of bytes read
+	uint32_t		searches;					//!< Number of search passes
+	uint32_t		crcROM;						//!< Number of ROM Id CRC failures (read ROM & search)
+	uint32_t		crcTemp;					//!< Number of temperature sensors scratchpad CRC failures
+	uint32_t		crcEEP;						//!< Number of EEPROM scratchpad CRC failures
+	uint32_t		lockContention;				//!< Number of declined bus locking attempts
+	uint32_t		strongPullTime;				//!< Strong pull-up hold time (in ms)
+	uint32_t		hStrongPull;				//!< Strong pull-up drive start time
+} OW_drv_stats_t;
+
+#if OW_DRV_STATS
+#define OW_STATS_INC(pOW, cnt)			do { (pOW)->pStats->cnt++; } while (0)			//!< Macro to increment \b cnt bus statistics counter of \b pOW instance
+#define OW_STATS_ADD(pOW, cnt, val)		do { (pOW)->pStats->cnt += (val); } while (0)	//!< Macro to add \b val to \b cnt bus statistics counter of \b pOW instance
+#else
+#define OW_STATS_INC(pOW, cnt)			do {} while (0)									//!< Macro to increment \b cnt bus statistics counter of \b pOW instance (statistics disabled)
+#define OW_STATS_ADD(pOW, cnt, val)		do {} while (0)									//!< Macro to add \b val to \b cnt bus statistics counter of \b pOW instance (statistics disabled)
+#endif
+
+
+/*!\enum OW_trace_type
+** \brief OneWire bus trace event types
+**/
+typedef enum PACK__ {
+	OW_TRACE__RESET = 1U,		//!< Bus reset (arg: presence pulse detected)
+	OW_TRACE__ROM_CMD,			//!< ROM command (arg: command)
+	OW_TRACE__SELECT,			//!< Device selected (arg: family code, val: ROM Id CRC)
+	OW_TRACE__SEARCH,			//!< Device found by search pass (arg: family code, val: ROM Id CRC)
+	OW_TRACE__WRITE_BYTE,		//!< Byte written, most likely function command (arg: byte)
+	OW_TRACE__READ_BYTE,		//!< Byte read (arg: byte)
+	OW_TRACE__WRITE,			//!< Bytes written (arg: first byte, val: number of bytes, saturated)
+	OW_TRACE__READ,				//!< Bytes read (arg: first byte, val: number of bytes, saturated)
+	OW_TRACE__STRONG_PULL,		//!< Strong pull-up (arg: driven)
+	OW_TRACE__CRC,				//!< CRC failure (arg: layer \ref OW_trace_crc)
+	OW_TRACE__ERROR,			//!< Transaction error (arg: error code MSB, val: error code LSB)
+	OW_TRACE__LOCK_DENIED,		//!< Bus locking attempt declined (arg: owner lock identifier MSB, val: owner lock identifier LSB)
+} OW_trace_type;
+
+
+/*!\enum OW_trace_crc
+** \brief OneWire bus trace CRC failure layers
+**/
+typedef enum PACK__ {
+	OW_TRACE_CRC__ROM = 1U,		//!< ROM Id CRC failure
+	OW_TRACE_CRC__TEMP,			//!< Temperature sensor scratchpad CRC failure
+	OW_TRACE_CRC__EEP,			//!< EEPROM scratchpad CRC failure
+} OW_trace_crc;
+
+
+/*!\struct OW_trace_evt_t
+** \brief OneWire bus trace event
+**/
+typedef struct {
+	uint32_t		ts;							//!< Timestamp (DWT cycles or HAL ticks, see \ref OW_trace_t clock)
+	uint8_t			bus;						//!< Bus index
+	uint8_t			type;						//!< Event type \ref OW_trace_type
+	uint8_t			arg;						//!< Event argument
+	uint8_t			val;						//!< Event value
+} OW_trace_evt_t;
+
+
+/*!\struct OW_trace_t
+** \brief OneWire bus trace ring buffer (dumped as is for host decoding)
+**/
+typedef struct {
+	volatile uint32_t	head;										//!< Next event index (free running)
+	uint32_t			clock;										//!< Timestamps clock frequency (in Hz)
+	OW_trace_evt_t		events[(OW_DRV_TRACE != 0U) ? OW_DRV_TRACE : 1U];	//!< Events ring buffer (oldest events overwritten)
+} OW_trace_t;
+
+#if OW_DRV_TRACE
+#define OW_TRACE(pOW, type, arg, val)	OW_Trace_Event((pOW), (type), (uint8_t) (arg), (uint8_t) (val))	//!< Macro to log \b type event with \b arg & \b val on \b pOW bus
+#else
+#define OW_TRACE(pOW, type, arg, val)	do {} while (0)													//!< Macro to log \b type event with \b arg & \b val on \b pOW bus (trace disabled)
+#endif
+
+
+/*!\struct OW_histo_t
+** \brief OneWire latency histogram (log2 buckets in us)
+**/
+typedef struct {
+	uint16_t		buckets[OW_HISTO_BUCKETS];	//!< Number of samples per bucket (saturated)
+	uint32_t		count;						//!< Number of samples
+	uint32_t		max;						//!< Maximum latency (in us)
+} OW_histo_t;
+
+
+typedef uint16_t		OW_mutex_t;		//!< Typedef for bus lock identifier (\ref OW_LOCK_ID_FREE when bus free / no identifier)
 typedef struct sOW_DRV	OW_DRV;			//!< Typedef for OW_DRV used by function pointers included in struct
 
 typedef FctERR (*pfOW_phyWrite_t)(const OW_DRV * const pOW, const uint8_t data);	//!< OneWire Write function typedef
@@ -70,13 +272,19 @@ struct sOW_DRV {
 #endif
 	OWSearch_State_t			search_state;		//!< OneWire bus search state
 	uint8_t						search_type;		//!< Search command
-	OW_mutex_t					mutex;				//!< Mutex for up to 32 devices
+	OW_mutex_t					mutex;				//!< Bus lock owner identifier (\ref OW_LOCK_ID_FREE when bus free)
 	bool						strong_pull_en;		//!< Set to true when strong pull-up is driven
 	bool						parasite_powered;	//!< Set to true when at least one device uses parasite power on the bus
+#if OW_DRV_STATS
+	OW_drv_stats_t *			pStats;				//!< Pointer to bus statistics (static storage, so that counters are updated from const driver instances)
+#endif
 };
 
 
 extern OW_DRV OWdrv[OW_BUS_NB];						//!< OWdrv structure
+#if OW_DRV_TRACE
+extern OW_trace_t OWtrace;							//!< OWdrv bus trace ring buffer (all buses)
+#endif
 
 #define IS_OW_DRV_IDX(IDX)	((IDX) < OW_BUS_NB)		//!< Macro for use with assert_param to check OWdrv index \b IDX is valid
 
@@ -109,28 +317,156 @@ void OW_StrongPull_Set(OW_DRV * const pOW, const bool en);
 
 
 /*!\brief Get unique lock identifier for new registered device
+** \note Lowest free identifier of bus allocation bitmap is returned (released identifiers are reused)
 ** \param[in] pOW - Pointer to OneWire driver instance
-** \return Lock identifier to affect the new registered device with
+** \return Lock identifier to affect the new registered device with (\ref OW_LOCK_ID_FREE if all \ref OW_LOCK_ID_MAX identifiers are allocated)
 **/
 OW_mutex_t OWInit_Get_Device_Lock_ID(const OW_DRV * const pOW);
 
+/*!\brief Release lock identifier of removed device
+** \note Bus is unlocked if held by released identifier
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \param[in] id - Device lock identifier
+** \return true: identifier released / false: identifier reserved or not allocated
+**/
+bool OW_Release_Device_Lock_ID(OW_DRV * const pOW, const OW_mutex_t id);
+
 /*!\brief One Wire bus locking attempt
 ** \param[in,out] pOW - Pointer to OneWire driver instance
-** \param[in] id - Device mutex identifier
+** \param[in] id - Device lock identifier
 ** \return true: lock successful / false: declined
 **/
 bool OW_lock_bus(OW_DRV * const pOW, const OW_mutex_t id);
 
 /*!\brief One Wire bus unlocking attempt
 ** \param[in,out] pOW - Pointer to OneWire driver instance
-** \param[in] id - Device mutex identifier
+** \param[in] id - Device lock identifier
 ** \return true: unlock successful / false: already unlocked or locked by another device
 **/
 bool OW_unlock_bus(OW_DRV * const pOW, const OW_mutex_t id);
 
+/*!\brief One Wire bus lock owner getter
+** \param[in] pOW - Pointer to OneWire driver instance
+** \return Lock identifier of bus owner (\ref OW_LOCK_ID_FREE when bus free)
+**/
+__INLINE OW_mutex_t NONNULL_INLINE__ OW_Get_Bus_Owner(const OW_DRV * const pOW) {
+	return pOW->mutex; }
+
 #define OW_DRV_MUTEX	1U		//!< OW bus Lock ID (always 1st ID)
 
 
+/*!\brief One Wire bus retry policy setter
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[in] pPolicy - Pointer to retry policy
+**/
+void NONNULL__ OW_Set_Retry_Policy(const OW_DRV * const pOW, const OW_retry_policy_t * const pPolicy);
+
+/*!\brief One Wire bus retry statistics snapshot
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[out] pStats - Pointer to retry statistics output
+**/
+void NONNULL__ OW_Get_Retry_Stats(const OW_DRV * const pOW, OW_retry_stats_t * const pStats);
+
+/*!\brief One Wire bus transaction retry check (following bus retry policy)
+** \note To be used as do/while condition around a whole transaction (reset included):
+** 		 do { err = transaction; } while (OW_Retry_Check(pOW, err, &attempt));
+** \note Back-off delay is applied before returning true
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[in] err - Transaction attempt error code
+** \param[in,out] pAttempt - Pointer to attempt counter (shall be initialized to 0 before first attempt)
+** \return true if transaction shall be attempted again
+**/
+bool NONNULL__ OW_Retry_Check(const OW_DRV * const pOW, const FctERR err, uint8_t * const pAttempt);
+
+
+#if OW_DRV_TIMESTAMPS
+/*!\brief One Wire timestamp
+** \return Timestamp (DWT cycles or HAL ticks)
+**/
+uint32_t OW_Timestamp(void);
+
+/*!\brief One Wire elapsed time since timestamp
+** \warning Elapsed time wraps after 2^32 DWT cycles (2^32 / SystemCoreClock seconds) when OW_DRV_CYCCNT is set, ~71 minutes otherwise
+** \param[in] hStart - Start timestamp (from \ref OW_Timestamp)
+** \return Elapsed time (in us)
+**/
+uint32_t OW_Elapsed_us(const uint32_t hStart);
+#endif
+
+
+#if OW_SLAVE_HISTO
+/*!\brief One Wire latency histogram sample recording
+** \param[in,out] pHisto - Pointer to latency histogram
+** \param[in] us - Latency (in us)
+**/
+void NONNULL__ OW_Histo_Record(OW_histo_t * const pHisto, const uint32_t us);
+
+/*!\brief One Wire latency histogram percentile
+** \param[in] pHisto - Pointer to latency histogram
+** \param[in] pct - Percentile (in %)
+** \return Upper bound of bucket reaching percentile (in us, maximum latency for last bucket)
+**/
+uint32_t NONNULL__ OW_Histo_Percentile(const OW_histo_t * const pHisto, const uint8_t pct);
+
+/*!\brief One Wire latency histogram reset
+** \param[in,out] pHisto - Pointer to latency histogram
+**/
+__INLINE void NONNULL_INLINE__ OW_Histo_Reset(OW_histo_t * const pHisto) {
+	UNUSED_RET memset(pHisto, 0, sizeof(OW_histo_t)); }
+
+/*!\brief One Wire bus search passes latency histogram getter
+** \param[in] pOW - Pointer to OneWire driver instance
+** \return Pointer to search passes latency histogram
+**/
+OW_histo_t * NONNULL__ OW_Get_Search_Histo(const OW_DRV * const pOW);
+#endif
+
+
+#if OW_DRV_TRACE
+/*!\brief One Wire bus trace event logging
+** \note Ring slot reserved with interrupts masked for a few cycles only, event written afterwards
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[in] type - Event type
+** \param[in] arg - Event argument
+** \param[in] val - Event value
+**/
+void NONNULL__ OW_Trace_Event(const OW_DRV * const pOW, const OW_trace_type type, const uint8_t arg, const uint8_t val);
+
+/*!\brief One Wire bus trace events copy (oldest first)
+** \param[out] events - Events output array
+** \param[in] max_nb - Maximum number of events to copy (most recent ones)
+** \return Number of events copied
+**/
+size_t NONNULL__ OW_Trace_Dump(OW_trace_evt_t events[], const size_t max_nb);
+
+/*!\brief One Wire bus trace clear
+**/
+void OW_Trace_Clear(void);
+#endif
+
+
+#if OW_DRV_STATS
+/*!\brief One Wire bus statistics snapshot
+** \param[in] pOW - Pointer to OneWire driver instance
+** \param[out] pStats - Pointer to statistics output
+**/
+void NONNULL__ OW_Get_Stats(const OW_DRV * const pOW, OW_drv_stats_t * const pStats);
+
+/*!\brief One Wire bus statistics reset
+** \param[in] pOW - Pointer to OneWire driver instance
+**/
+void NONNULL__ OW_Reset_Stats(const OW_DRV * const pOW);
+
+/*!\brief One Wire bus estimated busy time from statistics snapshot (standard speed timings)
+** \note Strong pull-up hold time not included
+** \param[in] pStats - Pointer to statistics snapshot
+** \return Estimated bus busy time (in us)
+**/
+__INLINE uint64_t NONNULL_INLINE__ OW_Stats_Bus_Time(const OW_drv_stats_t * const pStats) {
+	return ((uint64_t) pStats->resets * OW_RESET_TIME_US) + (((uint64_t) pStats->bitsWritten + pStats->bitsRead) * OW_SLOT_TIME_US); }
+#endif
+
+
 /*!\brief OneWire write bit to bus
 ** \param[in,out] pOW - Pointer to OneWire driver instance
 ** \param[in] bit - bit for transmission
@@ -176,6 +512,42 @@ FctERR NONNULL__ OWRead_byte(const OW_DRV * const pOW, uint8_t * const pByte);
 **/
 FctERR NONNULL__ OWRead(const OW_DRV * const pOW, uint8_t * const pData, const size_t len);
 
+/*!\brief OneWire read from bus with Dallas CRC8 accumulated on the fly
+** \note CRC8 is accumulated after each received byte (computed while bus is idle between slots, ready after last byte)
+** \note When received data ends with its CRC8, accumulated CRC8 (seeded with 0) is 0 if check passes
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \param[in,out] pData - Pointer to data for reception
+** \param[in] len - Number of data bytes to receive
+** \param[in,out] pCRC8 - Pointer to CRC8 accumulator (note that previous pointer content is used as CRC8 starting seed)
+** \return FctERR - Error code
+**/
+FctERR NONNULL__ OWRead_CRC8(const OW_DRV * const pOW, uint8_t * const pData, const size_t len, uint8_t * const pCRC8);
+
+/*!\brief OneWire read from bus with Dallas CRC16 accumulated on the fly
+** \note CRC16 is accumulated after each received byte (computed while bus is idle between slots, ready after last byte)
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \param[in,out] pData - Pointer to data for reception
+** \param[in] len - Number of data bytes to receive
+** \param[in,out] pCRC16 - Pointer to CRC16 accumulator (note that previous pointer content is used as CRC16 starting seed)
+** \return FctERR - Error code
+**/
+FctERR NONNULL__ OWRead_CRC16(const OW_DRV * const pOW, uint8_t * const pData, const size_t len, uint16_t * const pCRC16);
+
+
+/*!\brief OneWire bus reset
+** \note Can also be used to terminate an ongoing read (remaining bytes are discarded by slaves)
+** \param[in] pOW - Pointer to OneWire driver instance
+** \return FctERR - Error code
+**/
+FctERR NONNULL__ OWReset(const OW_DRV * const pOW);
+
+/*!\brief OneWire bus resets generation getter
+** \note Generation is incremented by each bus reset: a device session (e.g. memory streaming) started at a given generation
+**		 is known to be ended by another transaction on bus when generation changed
+** \param[in] pOW - Pointer to OneWire driver instance
+** \return Bus resets generation
+**/
+uint32_t NONNULL__ OW_Get_Reset_Gen(const OW_DRV * const pOW);
 
 /*!\brief OneWire device select
 ** \param[in,out] pOW - Pointer to OneWire driver instance
@@ -248,11 +620,11 @@ void NONNULL__ OWFamilySkipSetup(OW_DRV * const pOW);
 
 /*!\brief OneWire control sequence
 ** \param[in,out] pOW - Pointer to OneWire driver instance
-** \param[in] pROM - Pointer to ROM Id structure
+** \param[in] pROM - Pointer to ROM Id structure (may be NULL when \b broadcast is set)
 ** \param[in] broadcast - Set whether a skip or select command will be issued
 ** \return FctERR - Error code
 **/
-FctERR NONNULL__ OWROMCmd_Control_Sequence(const OW_DRV * const pOW, const OW_ROM_ID_t * const pROM, const bool broadcast);
+FctERR NONNULLX__(1) OWROMCmd_Control_Sequence(const OW_DRV * const pOW, const OW_ROM_ID_t * const pROM, const bool broadcast);
 
 
 /*!\brief OneWire check if at least one device is powered by the bus
@@ -0,0 +1,304 @@
+/*!\file OW_eep_log.c
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire EEPROM log-structured key/record store
+**/
+/****************************************************************/
+#include <string.h>
+
+#include "sarmfsw.h"
+
+#include "OW_crc.h"
+#include "OW_eep_log.h"
+/****************************************************************/
+
+
+/*!\struct OW_eep_log_scan_t
+** \brief Log mount scan context
+**/
+typedef struct {
+	OW_eep_log_t *	pLog;			//!< Pointer to log instance
+	uint16_t		newestSeq;		//!< Newest record sequence number
+	uint16_t		newestSlot;		//!< Newest record slot
+	bool			found;			//!< At least one valid record found
+} OW_eep_log_scan_t;
+
+
+/*!\brief Log index entry getter from key
+** \param[in,out] pLog - Pointer to log instance
+** \param[in] key - Record key
+** \return Pointer to index entry (NULL if key not found)
+**/
+__STATIC OW_eep_log_entry_t * NONNULL__ OW_EEP_Log_Find_Key(OW_eep_log_t * const pLog, const uint8_t key)
+{
+	OW_eep_log_entry_t * pEntry = NULL;
+
+	for (uintCPU_t i = 0 ; i < pLog->nb ; i++)
+	{
+		if (pLog->index[i].key == key)
+		{
+			pEntry = &pLog->index[i];
+			break;
+		}
+	}
+
+	return pEntry;
+}
+
+
+/*!\brief Log index entry getter from slot
+** \param[in,out] pLog - Pointer to log instance
+** \param[in] slot - Slot in log region
+** \return Pointer to index entry (NULL if slot doesn't hold latest record of any key)
+**/
+__STATIC OW_eep_log_entry_t * NONNULL__ OW_EEP_Log_Find_Slot(OW_eep_log_t * const pLog, const uint16_t slot)
+{
+	OW_eep_log_entry_t * pEntry = NULL;
+
+	for (uintCPU_t i = 0 ; i < pLog->nb ; i++)
+	{
+		if (pLog->index[i].slot == slot)
+		{
+			pEntry = &pLog->index[i];
+			break;
+		}
+	}
+
+	return pEntry;
+}
+
+
+/*!\brief Log record CRC8 computation
+** \param[in] pRec - Pointer to log record
+** \return Record CRC8
+**/
+__STATIC uint8_t NONNULL__ OW_EEP_Log_Record_CRC(const OW_eep_log_rec_t * const pRec)
+{
+	uint8_t crc = 0U;
+
+	OWCompute_DallasCRC8(&crc, pRec->bytes, OW_EEP_LOG_RECORD_SIZE - 1U);
+
+	return crc;
+}
+
+
+/*!\brief Log append record at next free slot
+** \note Oldest record of all skipped slots (if older than \ref OW_EEP_LOG_SEQ_REFRESH appends) is reported for relocation
+** \param[in,out] pLog - Pointer to log instance
+** \param[in,out] pEntry - Pointer to index entry to update
+** \param[in] key - Record key
+** \param[in] data - Record data
+** \param[out] ppStale - Pointer to stale index entry to relocate (NULL if none)
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_EEP_Log_Append(OW_eep_log_t * const pLog, OW_eep_log_entry_t * const pEntry, const uint8_t key,
+											const uint8_t data[OW_EEP_LOG_DATA_SIZE], OW_eep_log_entry_t ** const ppStale)
+{
+	OW_eep_log_rec_t	rec;
+	uint16_t			slot = pLog->head;
+
+	*ppStale = NULL;
+
+	for (uintCPU_t i = 0 ; i < pLog->slots ; i++)	// A free slot always exists (more slots than keys)
+	{
+		OW_eep_log_entry_t * const pLive = OW_EEP_Log_Find_Slot(pLog, slot);
+
+		if (pLive == NULL)	{ break; }
+
+		if (((uint16_t) (pLog->seq - pLive->seq) > OW_EEP_LOG_SEQ_REFRESH) && (*ppStale == NULL))	{ *ppStale = pLive; }
+
+		slot = (slot + 1U) % pLog->slots;
+	}
+
+	rec.key = key;
+	rec.seq = pLog->seq;
+	UNUSED_RET memcpy(rec.data, data, OW_EEP_LOG_DATA_SIZE);
+	rec.crc = OW_EEP_Log_Record_CRC(&rec);
+
+	const FctERR err = OW_EEP_Write_Memory(pLog->pEEP, rec.bytes, pLog->start + (slot * OW_EEP_LOG_RECORD_SIZE), OW_EEP_LOG_RECORD_SIZE);
+
+	if (err == ERROR_OK)
+	{
+		pEntry->key = key;
+		pEntry->slot = slot;
+		pEntry->seq = rec.seq;
+		UNUSED_RET memcpy(pEntry->data, rec.data, OW_EEP_LOG_DATA_SIZE);
+
+		pLog->head = (slot + 1U) % pLog->slots;
+		pLog->seq++;
+		pLog->appends++;
+	}
+
+	return err;
+}
+
+
+/*!\brief Log mount scan chunk delivery
+** \param[in,out] pCtx - Pointer to scan context
+** \param[in] pData - Pointer to chunk data
+** \param[in] addr - Chunk start address
+** \param[in] len - Chunk number of bytes (whole number of records)
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_EEP_Log_Scan_Chunk(void * const pCtx, const uint8_t * pData, const uint32_t addr, const size_t len)
+{
+	OW_eep_log_scan_t * const	pScan = (OW_eep_log_scan_t *) pCtx;
+	OW_eep_log_t * const		pLog = pScan->pLog;
+	uint16_t					slot = (uint16_t) ((addr - pLog->start) / OW_EEP_LOG_RECORD_SIZE);
+
+	for (size_t i = 0U ; i < len ; i += OW_EEP_LOG_RECORD_SIZE, slot++)
+	{
+		OW_eep_log_rec_t rec;
+
+		UNUSED_RET memcpy(rec.bytes, &pData[i], OW_EEP_LOG_RECORD_SIZE);
+
+		if (	(rec.key < OW_EEP_LOG_KEY_MIN) || (rec.key > OW_EEP_LOG_KEY_MAX)
+			||	(OW_EEP_Log_Record_CRC(&rec) != rec.crc))	{ continue; }	// Blank or corrupted row
+
+		OW_eep_log_entry_t * pEntry = OW_EEP_Log_Find_Key(pLog, rec.key);
+
+		if (pEntry == NULL)
+		{
+			if (pLog->nb < OW_EEP_LOG_KEYS_NB)	{ pEntry = &pLog->index[pLog->nb++]; }	// Index full: key ignored
+		}
+		else if ((int16_t) (rec.seq - pEntry->seq) <= 0)	{ pEntry = NULL; }		// Older record of key
+
+		if (pEntry != NULL)
+		{
+			pEntry->key = rec.key;
+			pEntry->slot = slot;
+			pEntry->seq = rec.seq;
+			UNUSED_RET memcpy(pEntry->data, rec.data, OW_EEP_LOG_DATA_SIZE);
+		}
+
+		if (!pScan->found || ((int16_t) (rec.seq - pScan->newestSeq) > 0))
+		{
+			pScan->newestSeq = rec.seq;
+			pScan->newestSlot = slot;
+			pScan->found = true;
+		}
+	}
+
+	return ERROR_OK;
+}
+
+
+/****************************************************************/
+
+
+FctERR NONNULL__ OW_EEP_Log_Init(OW_eep_log_t * const pLog, OW_eep_t * const pEEP, const uint32_t start, const uint16_t slots)
+{
+	FctERR err = ERROR_OK;
+
+	if (pEEP->props->scratchpad_size != OW_EEP_LOG_RECORD_SIZE)								{ err = ERROR_NOTAVAIL; }
+	else if ((start % OW_EEP_LOG_RECORD_SIZE) != 0U)										{ err = ERROR_VALUE; }
+	else if (slots <= OW_EEP_LOG_KEYS_NB)													{ err = ERROR_VALUE; }
+	else if ((start + ((uint32_t) slots * OW_EEP_LOG_RECORD_SIZE)) > pEEP->props->mem_size)	{ err = ERROR_RANGE; }
+	else
+	{
+		UNUSED_RET memset(pLog, 0, sizeof(OW_eep_log_t));
+
+		pLog->pEEP = pEEP;
+		pLog->start = start;
+		pLog->slots = slots;
+	}
+
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Log_Mount(OW_eep_log_t * const pLog, uint8_t scan[], const size_t scan_size)
+{
+	OW_eep_log_scan_t	ctx = { pLog, 0U, 0U, false };
+	FctERR				err = ERROR_OK;
+
+	if (pLog->pEEP == NULL)							{ err = ERROR_INSTANCE; }
+	else if (scan_size < OW_EEP_LOG_RECORD_SIZE)	{ err = ERROR_VALUE; }
+	if (err != ERROR_OK)							{ goto ret; }
+
+	pLog->mounted = false;
+	pLog->nb = 0U;
+
+	// Whole region streamed with a single read memory command, scan buffer holding a whole number of records
+	err = OW_EEP_Read_Stream(pLog->pEEP, pLog->start, (size_t) pLog->slots * OW_EEP_LOG_RECORD_SIZE,
+							scan, scan_size - (scan_size % OW_EEP_LOG_RECORD_SIZE), OW_EEP_Log_Scan_Chunk, &ctx);
+
+	if (err == ERROR_OK)
+	{
+		pLog->head = ctx.found ? ((ctx.newestSlot + 1U) % pLog->slots) : 0U;
+		pLog->seq = ctx.found ? (ctx.newestSeq + 1U) : 0U;
+		pLog->appends = 0U;
+		pLog->relocations = 0U;
+		pLog->mounted = true;
+	}
+
+	ret:
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Log_Write(OW_eep_log_t * const pLog, const uint8_t key, const uint8_t data[OW_EEP_LOG_DATA_SIZE])
+{
+	OW_eep_log_entry_t *	pStale;
+	OW_eep_log_entry_t *	pEntry;
+	bool					newKey = false;
+	FctERR					err = ERROR_OK;
+
+	if (!pLog->mounted)												{ err = ERROR_NOTAVAIL; }
+	else if ((key < OW_EEP_LOG_KEY_MIN) || (key > OW_EEP_LOG_KEY_MAX))	{ err = ERROR_VALUE; }
+	if (err != ERROR_OK)											{ goto ret; }
+
+	pEntry = OW_EEP_Log_Find_Key(pLog, key);
+
+	if (pEntry == NULL)
+	{
+		if (pLog->nb >= OW_EEP_LOG_KEYS_NB)
+		{
+			err = ERROR_OVERFLOW;
+			goto ret;
+		}
+
+		pEntry = &pLog->index[pLog->nb];	// Not part of index (not live) until written
+		newKey = true;
+	}
+
+	err = OW_EEP_Log_Append(pLog, pEntry, key, data, &pStale);
+
+	if (err == ERROR_OK)
+	{
+		if (newKey)	{ pLog->nb++; }
+
+		if ((pStale != NULL) && (pStale != pEntry))		// Stale record relocated (sequence numbers comparison kept valid at next mount)
+		{
+			OW_eep_log_entry_t * pDummy;
+
+			err = OW_EEP_Log_Append(pLog, pStale, pStale->key, pStale->data, &pDummy);
+
+			if (err == ERROR_OK)	{ pLog->relocations++; }
+		}
+	}
+
+	ret:
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Log_Read(const OW_eep_log_t * const pLog, const uint8_t key, uint8_t data[OW_EEP_LOG_DATA_SIZE])
+{
+	FctERR err = ERROR_NOTAVAIL;
+
+	for (uintCPU_t i = 0 ; i < pLog->nb ; i++)
+	{
+		if (pLog->index[i].key == key)
+		{
+			UNUSED_RET memcpy(data, pLog->index[i].data, OW_EEP_LOG_DATA_SIZE);
+			err = ERROR_OK;
+			break;
+		}
+	}
+
+	return err;
+}
+
+
+/****************************************************************/
@@ -0,0 +1,143 @@
+/*!\file OW_eep_log.h
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire EEPROM log-structured key/record store
+** \note Each record fills exactly one scratchpad row: an update is a single scratchpad write/copy appended at next free row
+**		 of the log region (rows holding latest record of a key are skipped), spreading wear over the whole region.
+** \note Latest record of each key is kept in RAM index, built at mount by a single streaming memory read of the log region.
+** \warning Only EEPROM devices with 8 bytes scratchpad are supported (DS28E07, MAX31826).
+**/
+/****************************************************************/
+#ifndef OW_EEP_LOG_H__
+	#define OW_EEP_LOG_H__
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+#include "sarmfsw.h"
+
+#include "OW_dev_eeprom.h"
+
+
+#ifndef OW_EEP_LOG_KEYS_NB
+#define OW_EEP_LOG_KEYS_NB		16U			//!< Maximum number of keys in each log
+#endif
+
+#ifndef OW_EEP_LOG_SEQ_REFRESH
+#define OW_EEP_LOG_SEQ_REFRESH	0x4000U		//!< Record age (in appends) above which a skipped record is relocated (keeps sequence numbers comparison valid)
+#endif
+/****************************************************************/
+
+
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+#define OW_EEP_LOG_RECORD_SIZE	8U			//!< Log record size (one scratchpad row)
+#define OW_EEP_LOG_DATA_SIZE	4U			//!< Log record data size
+#define OW_EEP_LOG_KEY_MIN		0x01U		//!< Log minimum key value (0x00 & 0xFF are reserved for blank rows)
+#define OW_EEP_LOG_KEY_MAX		0xFEU		//!< Log maximum key value (0x00 & 0xFF are reserved for blank rows)
+
+
+// *****************************************************************************
+// Section: Types
+// *****************************************************************************
+/*!\struct OW_eep_log_rec_t
+** \brief Log record (stored in one EEPROM row)
+**/
+typedef struct PACK__ {
+	union PACK__ {
+		uint8_t			bytes[OW_EEP_LOG_RECORD_SIZE];	//!< Record bytes array
+		struct PACK__ {
+			uint8_t		key;							//!< Record key
+			uint16_t	seq;							//!< Record sequence number
+			uint8_t		data[OW_EEP_LOG_DATA_SIZE];		//!< Record data
+			uint8_t		crc;							//!< Record Dallas CRC8 (over previous bytes)
+		};
+	};
+} OW_eep_log_rec_t;
+
+
+/*!\struct OW_eep_log_entry_t
+** \brief Log index entry (latest record of a key)
+**/
+typedef struct {
+	uint8_t		key;							//!< Record key
+	uint16_t	slot;							//!< Record slot in log region
+	uint16_t	seq;							//!< Record sequence number
+	uint8_t		data[OW_EEP_LOG_DATA_SIZE];		//!< Record data
+} OW_eep_log_entry_t;
+
+
+/*!\struct OW_eep_log_t
+** \brief Log-structured record store instance
+**/
+typedef struct {
+	OW_eep_t *			pEEP;						//!< Pointer to EEPROM device type structure
+	uint32_t			start;						//!< Log region start address (row aligned)
+	uint16_t			slots;						//!< Log region number of rows
+	uint16_t			head;						//!< Next slot to look for a free row from
+	uint16_t			seq;						//!< Next record sequence number
+	uint8_t				nb;							//!< Number of keys in index
+	OW_eep_log_entry_t	index[OW_EEP_LOG_KEYS_NB];	//!< Latest record of each key
+	uint32_t			appends;					//!< Number of records appended since mount
+	uint32_t			relocations;				//!< Number of stale records relocated since mount
+	bool				mounted;					//!< Log mounted
+} OW_eep_log_t;
+
+
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+/*!\brief Log-structured record store init
+** \param[in,out] pLog - Pointer to log instance
+** \param[in] pEEP - Pointer to EEPROM device type structure
+** \param[in] start - Log region start address (shall be row aligned)
+** \param[in] slots - Log region number of rows (shall be greater than \ref OW_EEP_LOG_KEYS_NB)
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_EEP_Log_Init(OW_eep_log_t * const pLog, OW_eep_t * const pEEP, const uint32_t start, const uint16_t slots);
+
+/*!\brief Log-structured record store mount (index built reading log region)
+** \note Log region is streamed with a single read memory command, whatever the scan buffer size
+** \param[in,out] pLog - Pointer to log instance
+** \param[in,out] scan - Scan buffer (bounce buffer)
+** \param[in] scan_size - Scan buffer size (at least \ref OW_EEP_LOG_RECORD_SIZE)
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_EEP_Log_Mount(OW_eep_log_t * const pLog, uint8_t scan[], const size_t scan_size);
+
+/*!\brief Log-structured record store write record
+** \param[in,out] pLog - Pointer to log instance
+** \param[in] key - Record key (from \ref OW_EEP_LOG_KEY_MIN to \ref OW_EEP_LOG_KEY_MAX)
+** \param[in] data - Record data
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_EEP_Log_Write(OW_eep_log_t * const pLog, const uint8_t key, const uint8_t data[OW_EEP_LOG_DATA_SIZE]);
+
+/*!\brief Log-structured record store read record
+** \note Record is read from RAM index (no bus transaction)
+** \param[in] pLog - Pointer to log instance
+** \param[in] key - Record key
+** \param[out] data - Record data
+** \return FctERR - error code
+** \retval ERROR_NOTAVAIL - Key not found
+**/
+FctERR NONNULL__ OW_EEP_Log_Read(const OW_eep_log_t * const pLog, const uint8_t key, uint8_t data[OW_EEP_LOG_DATA_SIZE]);
+
+
+/*!\brief Log-structured record store number of keys getter
+** \param[in] pLog - Pointer to log instance
+** \return Number of keys in log
+**/
+__INLINE uint8_t NONNULL_INLINE__ OW_EEP_Log_Get_Keys(const OW_eep_log_t * const pLog) {
+	return pLog->nb; }
+
+
+/****************************************************************/
+#ifdef __cplusplus
+	}
+#endif
+
+#endif
+/****************************************************************/
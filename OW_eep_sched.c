@@ -0,0 +1,173 @@
+/*!\file OW_eep_sched.c
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire multi-device EEPROM write scheduler
+**/
+/****************************************************************/
+#include "sarmfsw.h"
+
+#include "OW_drv.h"
+#include "OW_component.h"
+
+#include "OW_eep_sched.h"
+/****************************************************************/
+
+
+OW_eep_sched_t OWeepSched[OW_BUS_NB] = { 0 };		//!< Multi-device EEPROM write scheduler structures (one per bus)
+
+
+/****************************************************************/
+
+
+/*!\brief Multi-device EEPROM write scheduler bus structure getter
+** \param[in] pOW - Pointer to OneWire driver instance
+** \return Pointer to scheduler bus structure (NULL if unknown instance)
+**/
+__STATIC OW_eep_sched_t * NONNULL__ OW_EEP_Sched_Get_Bus(const OW_DRV * const pOW)
+{
+	const int32_t idx = pOW - OWdrv;
+
+	return IS_OW_DRV_IDX((uint32_t) idx) ? &OWeepSched[idx] : NULL;
+}
+
+
+/*!\brief Multi-device EEPROM write scheduler device index getter
+** \param[in] pSched - Pointer to scheduler bus structure
+** \param[in] pEEP - Pointer to EEPROM device type structure
+** \return Device index in scheduler (number of pending devices if not found)
+**/
+__STATIC uint8_t NONNULL__ OW_EEP_Sched_Find(const OW_eep_sched_t * const pSched, const OW_eep_t * const pEEP)
+{
+	uint8_t idx = 0U;
+
+	while ((idx < pSched->nb) && (pSched->devices[idx] != pEEP))	{ idx++; }
+
+	return idx;
+}
+
+
+/*!\brief Multi-device EEPROM write scheduler device removal
+** \param[in,out] pSched - Pointer to scheduler bus structure
+** \param[in] idx - Device index in scheduler
+**/
+__STATIC void NONNULL__ OW_EEP_Sched_Drop(OW_eep_sched_t * const pSched, const uint8_t idx)
+{
+	pSched->devices[idx]->overlap = false;
+
+	for (uint8_t i = idx ; i < (pSched->nb - 1U) ; i++)	{ pSched->devices[i] = pSched->devices[i + 1U]; }
+	pSched->nb--;
+}
+
+
+FctERR NONNULL__ OW_EEP_Sched_Submit(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len)
+{
+	const OW_DRV * const	pOW = pEEP->slave_inst->cfg.bus_inst;
+	OW_eep_sched_t * const	pSched = OW_EEP_Sched_Get_Bus(pOW);
+	FctERR					err = ERROR_OK;
+
+	if (pSched == NULL)										{ err = ERROR_INSTANCE; }
+	else if (OW_EEP_Sched_Find(pSched, pEEP) < pSched->nb)	{ err = ERROR_BUSY; }		// Device already scheduled
+	else if (pSched->nb >= OW_EEP_SCHED_DEVICES_NB)			{ err = ERROR_OVERFLOW; }	// No more room on bus
+	else if (pSched->overlap && !pEEP->extPowered)			{ err = ERROR_BUSY; }		// Strong pull-up needed: waits for overlapped session end
+	else
+	{
+		err = OW_EEP_Write_Memory_Async(pEEP, pData, addr, len);
+
+		if (err == ERROR_OK)
+		{
+			if (pSched->nb == 0U)	{ pSched->overlap = pEEP->extPowered; }	// Session overlapped only when started by an externally powered device
+
+			pEEP->overlap = pSched->overlap;
+			pSched->devices[pSched->nb++] = pEEP;
+		}
+	}
+
+	return err;
+}
+
+
+FctERR NONNULL__ OW_EEP_Sched_Remove(OW_eep_t * const pEEP)
+{
+	OW_eep_sched_t * const	pSched = OW_EEP_Sched_Get_Bus(pEEP->slave_inst->cfg.bus_inst);
+	FctERR					err = ERROR_OK;
+
+	if (pSched == NULL)								{ err = ERROR_INSTANCE; }
+	else if (OW_EEP_Write_Memory_Ongoing(pEEP))		{ err = ERROR_BUSY; }	// Write job shall be completed first
+	else
+	{
+		const uint8_t idx = OW_EEP_Sched_Find(pSched, pEEP);
+
+		if (idx < pSched->nb)	{ OW_EEP_Sched_Drop(pSched, idx); }
+	}
+
+	return err;
+}
+
+
+/*!\brief Multi-device EEPROM write scheduler device job step
+** \param[in,out] pSched - Pointer to scheduler bus structure
+** \param[in] idx - Device index in scheduler
+** \return true if device job is done (device removed from scheduler)
+**/
+__STATIC bool NONNULL__ OW_EEP_Sched_Step(OW_eep_sched_t * const pSched, const uint8_t idx)
+{
+	OW_eep_t * const	pEEP = pSched->devices[idx];
+	const FctERR		err = OW_EEP_Write_Memory_Handler(pEEP);
+	const bool			done = (err != ERROR_BUSY);
+
+	if (done)
+	{
+		pSched->err |= err;
+		OW_EEP_Sched_Drop(pSched, idx);
+	}
+
+	return done;
+}
+
+
+FctERR NONNULL__ OW_EEP_Sched_Handler(const OW_DRV * const pOW)
+{
+	OW_eep_sched_t * const	pSched = OW_EEP_Sched_Get_Bus(pOW);
+	FctERR					err = ERROR_OK;
+
+	if (pSched == NULL)	{ err = ERROR_INSTANCE; }
+	else if (pSched->nb != 0U)
+	{
+		for (uint8_t i = 0U ; i < pSched->nb ; )	// Devices which job stopped outside of scheduler are released
+		{
+			if (!OW_EEP_Write_Memory_Ongoing(pSched->devices[i]))	{ OW_EEP_Sched_Drop(pSched, i); }
+			else													{ i++; }
+		}
+
+		if (pSched->overlap)
+		{
+			for (uint8_t i = 0U ; i < pSched->nb ; )	// Every job advanced: scratchpad loading overlaps other devices copy cycles
+			{
+				if (!OW_EEP_Sched_Step(pSched, i))	{ i++; }
+			}
+		}
+		else if (pSched->nb != 0U)
+		{
+			if (pSched->idx >= pSched->nb)	{ pSched->idx = 0U; }
+
+			UNUSED_RET OW_EEP_Sched_Step(pSched, pSched->idx);	// Current job only (strong pull-up needed during copy cycles)
+		}
+
+		if (pSched->nb != 0U)	{ err = ERROR_BUSY; }
+		else
+		{
+			err = pSched->err;
+			pSched->err = ERROR_OK;
+		}
+	}
+
+	return err;
+}
+
+
+uint8_t NONNULL__ OW_EEP_Sched_Pending(const OW_DRV * const pOW)
+{
+	const OW_eep_sched_t * const pSched = OW_EEP_Sched_Get_Bus(pOW);
+
+	return (pSched != NULL) ? pSched->nb : 0U;
+}
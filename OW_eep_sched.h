@@ -0,0 +1,92 @@
+/*!\file OW_eep_sched.h
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire multi-device EEPROM write scheduler
+** \note Scheduling sessions started by a device declared externally powered (\ref OW_EEP_Set_Ext_Powered, no strong pull-up required)
+**		 overlap scratchpad loading of a device with copy cycles of the others, only externally powered devices may join them.
+**		 Other sessions (default) get their write jobs serialized.
+**/
+/****************************************************************/
+#ifndef OW_EEP_SCHED_H__
+	#define OW_EEP_SCHED_H__
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+#include "sarmfsw.h"
+
+#include "OW_drv.h"
+#include "OW_dev_eeprom.h"
+
+
+#ifndef OW_EEP_SCHED_DEVICES_NB
+#define OW_EEP_SCHED_DEVICES_NB	8U		//!< Maximum number of EEPROM devices with pending write jobs on each bus
+#endif
+/****************************************************************/
+
+
+// *****************************************************************************
+// Section: Types
+// *****************************************************************************
+/*!\struct OW_eep_sched_t
+** \brief Multi-device EEPROM write scheduler bus structure
+**/
+typedef struct {
+	OW_eep_t *	devices[OW_EEP_SCHED_DEVICES_NB];	//!< EEPROM devices with pending write jobs
+	uint8_t		nb;									//!< Number of devices with pending write jobs
+	uint8_t		idx;								//!< Device handled when jobs are serialized
+	bool		overlap;							//!< Write jobs overlapped on bus
+	FctERR		err;								//!< Errors accumulated by write jobs since last scheduler idle state
+} OW_eep_sched_t;
+
+
+extern OW_eep_sched_t OWeepSched[OW_BUS_NB];		//!< Multi-device EEPROM write scheduler structures (one per bus)
+
+
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+/*!\brief Submit EEPROM device write job to scheduler
+** \note Completion of each job is reported by \ref OW_EEP_Write_Memory_Done_Callback
+** \note Devices which job is stopped outside of scheduler are released at next \ref OW_EEP_Sched_Handler call
+** \warning Data buffer shall remain valid until job completion
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \param[in] pData - Pointer to data for transmission
+** \param[in] addr - Target memory cell start address
+** \param[in] len - Number of data bytes to transmit
+** \return FctERR - error code
+** \retval ERROR_BUSY - Device already scheduled, or device not externally powered while overlapped session is ongoing
+**/
+FctERR NONNULL__ OW_EEP_Sched_Submit(OW_eep_t * const pEEP, const uint8_t * pData, const uint32_t addr, const size_t len);
+
+/*!\brief Remove EEPROM device from scheduler
+** \note Nothing done if device is not scheduled
+** \param[in,out] pEEP - Pointer to EEPROM device type structure
+** \return FctERR - error code
+** \retval ERROR_BUSY - Device write job ongoing
+**/
+FctERR NONNULL__ OW_EEP_Sched_Remove(OW_eep_t * const pEEP);
+
+/*!\brief Multi-device EEPROM write scheduler handler
+** \note Non blocking mode: each call advances every pending job (overlapped bus) or current job (serialized bus) by one step
+** \note Handler shall be called periodically in a main like loop or from a timer
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - error code (ERROR_BUSY while jobs are pending, accumulated jobs errors once all done)
+**/
+FctERR NONNULL__ OW_EEP_Sched_Handler(const OW_DRV * const pOW);
+
+/*!\brief Multi-device EEPROM write scheduler pending jobs getter
+** \param[in] pOW - Pointer to OneWire driver instance
+** \return Number of pending write jobs on bus
+**/
+uint8_t NONNULL__ OW_EEP_Sched_Pending(const OW_DRV * const pOW);
+
+
+/****************************************************************/
+#ifdef __cplusplus
+	}
+#endif
+
+#endif
+/****************************************************************/
@@ -53,6 +53,9 @@ FctERR OWInit_phy(const uint8_t idx)
 		err = OWInit_GPIO(idx);
 	}
 #endif
+#if defined(OW_PHY_STATIC)
+	if ((err == ERROR_OK) && (pOW->phy != OW_PHY_STATIC_TYPE))	{ err = ERROR_NOTAVAIL; }	// Bus primitives bound to another physical layer
+#endif
 
 	ret:
 	if (err != ERROR_OK)
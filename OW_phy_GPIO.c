@@ -68,12 +68,7 @@ __STATIC_INLINE void NONNULL_INLINE__ OW_GPIO_WriteLow(const OW_GPIO_HandleTypeD
 }
 
 
-/*!\brief OneWire GPIO write bit to bus
-** \param[in,out] pOW - Pointer to OneWire driver instance
-** \param[in] bit - Bit for transmission
-** \return FctERR - Error code
-**/
-__STATIC FctERR NONNULL__ OW_GPIO_Write_bit(const OW_DRV * const pOW, const uint8_t bit)
+FctERR NONNULL__ OW_GPIO_Write_bit(const OW_DRV * const pOW, const uint8_t bit)
 {
 	const OW_GPIO_HandleTypeDef * const	pGPIO = pOW->phy_inst.GPIO_inst;
 	uint8_t								delay[2];
@@ -132,12 +127,7 @@ __STATIC FctERR NONNULL__ OW_GPIO_Write_byte(const OW_DRV * const pOW, const uin
 #endif
 
 
-/*!\brief OneWire GPIO read bit from bus
-** \param[in,out] pOW - Pointer to OneWire driver instance
-** \param[in,out] pBit - Pointer to bit for reception
-** \return FctERR - Error code
-**/
-__STATIC FctERR NONNULL__ OW_GPIO_Read_bit(const OW_DRV * const pOW, uint8_t * const pBit)
+FctERR NONNULL__ OW_GPIO_Read_bit(const OW_DRV * const pOW, uint8_t * const pBit)
 {
 	const OW_GPIO_HandleTypeDef * const	pGPIO = pOW->phy_inst.GPIO_inst;
 
@@ -185,11 +175,7 @@ FctERR NONNULL__ OW_GPIO_Read_byte(const OW_DRV * const pOW, uint8_t * const pBy
 #endif
 
 
-/*!\brief OneWire GPIO bus reset
-** \param[in,out] pOW - Pointer to OneWire driver instance
-** \return FctERR - Error code
-**/
-__STATIC FctERR NONNULL__ OW_GPIO_Reset(const OW_DRV * const pOW)
+FctERR NONNULL__ OW_GPIO_Reset(const OW_DRV * const pOW)
 {
 	const OW_GPIO_HandleTypeDef * const	pGPIO = pOW->phy_inst.GPIO_inst;
 	FctERR								err = ERROR_BUSOFF;
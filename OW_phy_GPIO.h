@@ -46,12 +46,34 @@ typedef struct {
 // *****************************************************************************
 // Section: Interface Routines
 // *****************************************************************************
+struct sOW_DRV;	// OneWire driver instance (defined in OW_drv.h)
+
 /*!\brief OneWire physical driver instance on GPIO init
 ** \param[in] idx - Instance index
 ** \return FctERR - Error code
 **/
 FctERR OWInit_GPIO(const uint8_t idx);
 
+/*!\brief OneWire GPIO write bit to bus
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \param[in] bit - Bit for transmission
+** \return FctERR - Error code
+**/
+FctERR NONNULL__ OW_GPIO_Write_bit(const struct sOW_DRV * const pOW, const uint8_t bit);
+
+/*!\brief OneWire GPIO read bit from bus
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \param[in,out] pBit - Pointer to bit for reception
+** \return FctERR - Error code
+**/
+FctERR NONNULL__ OW_GPIO_Read_bit(const struct sOW_DRV * const pOW, uint8_t * const pBit);
+
+/*!\brief OneWire GPIO bus reset
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - Error code
+**/
+FctERR NONNULL__ OW_GPIO_Reset(const struct sOW_DRV * const pOW);
+
 
 /****************************************************************/
 #endif
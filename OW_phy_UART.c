@@ -44,12 +44,7 @@ __STATIC FctERR OW_UART_Set_BR(UART_HandleTypeDef * const pUART, const uint32_t
 }
 
 
-/*!\brief OneWire UART write bit to bus
-** \param[in,out] pOW - Pointer to OneWire driver instance
-** \param[in] bit - Bit for transmission
-** \return FctERR - Error code
-**/
-__STATIC FctERR NONNULL__ OW_UART_Write_bit(const OW_DRV * const pOW, const uint8_t bit)
+FctERR NONNULL__ OW_UART_Write_bit(const OW_DRV * const pOW, const uint8_t bit)
 {
 	const uint32_t	br = 115200UL;
 	const uint32_t	timeout = 2UL;
@@ -98,12 +93,7 @@ __STATIC FctERR NONNULL__ OW_UART_Write_byte(const OW_DRV * const pOW, const uin
 #endif
 
 
-/*!\brief OneWire UART read bit from bus
-** \param[in,out] pOW - Pointer to OneWire driver instance
-** \param[in,out] pBit - Pointer to bit for reception
-** \return FctERR - Error code
-**/
-__STATIC FctERR NONNULL__ OW_UART_Read_bit(const OW_DRV * const pOW, uint8_t * const pBit)
+FctERR NONNULL__ OW_UART_Read_bit(const OW_DRV * const pOW, uint8_t * const pBit)
 {
 	const uint32_t	br = 115200UL;
 	const uint32_t	timeout = 2UL;
@@ -154,11 +144,7 @@ FctERR NONNULL__ OW_UART_Read_byte(const OW_DRV * const pOW, uint8_t * const pBy
 #endif
 
 
-/*!\brief OneWire UART bus reset
-** \param[in,out] pOW - Pointer to OneWire driver instance
-** \return FctERR - Error code
-**/
-__STATIC FctERR NONNULL__ OW_UART_Reset(const OW_DRV * const pOW)
+FctERR NONNULL__ OW_UART_Reset(const OW_DRV * const pOW)
 {
 	const uint32_t	br = 9600UL;
 	const uint32_t	timeout = 2UL;
@@ -31,12 +31,34 @@
 // *****************************************************************************
 // Section: Interface Routines
 // *****************************************************************************
+struct sOW_DRV;	// OneWire driver instance (defined in OW_drv.h)
+
 /*!\brief OneWire physical driver instance on UART init
 ** \param[in] idx - Instance index
 ** \return FctERR - Error code
 **/
 FctERR NONNULL__ OWInit_UART(const uint8_t idx);
 
+/*!\brief OneWire UART write bit to bus
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \param[in] bit - Bit for transmission
+** \return FctERR - Error code
+**/
+FctERR NONNULL__ OW_UART_Write_bit(const struct sOW_DRV * const pOW, const uint8_t bit);
+
+/*!\brief OneWire UART read bit from bus
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \param[in,out] pBit - Pointer to bit for reception
+** \return FctERR - Error code
+**/
+FctERR NONNULL__ OW_UART_Read_bit(const struct sOW_DRV * const pOW, uint8_t * const pBit);
+
+/*!\brief OneWire UART bus reset
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - Error code
+**/
+FctERR NONNULL__ OW_UART_Reset(const struct sOW_DRV * const pOW);
+
 
 /****************************************************************/
 #endif
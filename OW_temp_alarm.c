@@ -0,0 +1,348 @@
+/*!\file OW_temp_alarm.c
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire temperature sensors alarm window polling
+**/
+/****************************************************************/
+#include <string.h>
+
+#include "sarmfsw.h"
+
+#include "OW_drv.h"
+#include "OW_component.h"
+
+#include "OW_temp_alarm.h"
+/****************************************************************/
+
+
+OW_temp_alarm_bus_t OWtempAlarm[OW_BUS_NB] = { 0 };		//!< Alarm window polling structures (one per bus)
+
+
+#define OW_TEMP_ALARM_MIN	-55		//!< Lowest alarm threshold (sensors lowest temperature)
+#define OW_TEMP_ALARM_MAX	125		//!< Highest alarm threshold (sensors highest temperature)
+
+
+/****************************************************************/
+
+
+/*!\brief Alarm window polling bus structure getter
+** \param[in] pOW - Pointer to OneWire driver instance
+** \return Pointer to alarm window polling bus structure (NULL if unknown instance)
+**/
+__STATIC OW_temp_alarm_bus_t * NONNULL__ OW_TEMP_Alarm_Get_Bus(const OW_DRV * const pOW)
+{
+	const int32_t idx = pOW - OWdrv;
+
+	return IS_OW_DRV_IDX((uint32_t) idx) ? &OWtempAlarm[idx] : NULL;
+}
+
+
+FctERR NONNULL__ OW_TEMP_Alarm_Register(OW_temp_t * const pTEMP)
+{
+	OW_temp_alarm_bus_t * const	pBus = OW_TEMP_Alarm_Get_Bus(pTEMP->slave_inst->cfg.bus_inst);
+	FctERR						err = ERROR_OK;
+
+	if (pBus == NULL)								{ err = ERROR_INSTANCE; }
+	else if (pTEMP->props->cfgBytes < 2U)			{ err = ERROR_NOTAVAIL; }	// No alarm thresholds on device
+	else if (pBus->nb >= OW_TEMP_ALARM_SENSORS_NB)	{ err = ERROR_OVERFLOW; }	// No more room on bus
+	else if (pBus->state == OW_TEMP_ALARM__CONVERT)	{ err = ERROR_BUSY; }		// Cycle ongoing
+	else
+	{
+		OW_TEMP_Set_Conversion_Mode(pTEMP, false);
+		pBus->alarmed[pBus->nb] = false;
+		pBus->sensors[pBus->nb++] = pTEMP;
+		pBus->armed = false;
+	}
+
+	return err;
+}
+
+
+FctERR NONNULL__ OW_TEMP_Alarm_Unregister(const OW_temp_t * const pTEMP)
+{
+	OW_temp_alarm_bus_t * const	pBus = OW_TEMP_Alarm_Get_Bus(pTEMP->slave_inst->cfg.bus_inst);
+	FctERR						err = ERROR_OK;
+
+	if (pBus == NULL)	{ err = ERROR_INSTANCE; }
+	else
+	{
+		for (uint8_t i = 0U ; i < pBus->nb ; i++)
+		{
+			if (pBus->sensors[i] == pTEMP)
+			{
+				if (pBus->state == OW_TEMP_ALARM__CONVERT)	{ err = ERROR_BUSY; }	// Cycle ongoing
+				else
+				{
+					for (uint8_t j = i ; j < (pBus->nb - 1U) ; j++)
+					{
+						pBus->sensors[j] = pBus->sensors[j + 1U];
+						pBus->alarmed[j] = pBus->alarmed[j + 1U];
+					}
+					pBus->nb--;
+				}
+
+				break;
+			}
+		}
+	}
+
+	return err;
+}
+
+
+FctERR NONNULL__ OW_TEMP_Alarm_Set_Margin(const OW_DRV * const pOW, const uint8_t margin)
+{
+	OW_temp_alarm_bus_t * const	pBus = OW_TEMP_Alarm_Get_Bus(pOW);
+	FctERR						err = ERROR_OK;
+
+	if (pBus == NULL)	{ err = ERROR_INSTANCE; }
+	else
+	{
+		pBus->margin = margin;
+		pBus->armed = false;
+	}
+
+	return err;
+}
+
+
+FctERR NONNULL__ OW_TEMP_Alarm_Rearm(const OW_DRV * const pOW)
+{
+	OW_temp_alarm_bus_t * const	pBus = OW_TEMP_Alarm_Get_Bus(pOW);
+	FctERR						err = ERROR_OK;
+
+	if (pBus == NULL)	{ err = ERROR_INSTANCE; }
+	else				{ pBus->armed = false; }
+
+	return err;
+}
+
+
+OW_temp_alarm_state NONNULL__ OW_TEMP_Alarm_Get_State(const OW_DRV * const pOW)
+{
+	const OW_temp_alarm_bus_t * const pBus = OW_TEMP_Alarm_Get_Bus(pOW);
+
+	return (pBus != NULL) ? pBus->state : OW_TEMP_ALARM__IDLE;
+}
+
+
+bool NONNULL__ OW_TEMP_Alarm_Is_Alarmed(const OW_temp_t * const pTEMP)
+{
+	const OW_temp_alarm_bus_t * const	pBus = OW_TEMP_Alarm_Get_Bus(pTEMP->slave_inst->cfg.bus_inst);
+	bool								alarmed = false;
+
+	if (pBus != NULL)
+	{
+		for (size_t i = 0U ; i < pBus->nb ; i++)
+		{
+			if (pBus->sensors[i] == pTEMP)
+			{
+				alarmed = pBus->alarmed[i];
+				break;
+			}
+		}
+	}
+
+	return alarmed;
+}
+
+
+/****************************************************************/
+
+
+/*!\brief Alarm window centring around last sensor temperature
+** \param[in] pBus - Pointer to alarm window polling bus structure
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \param[in] force - Window written even if matching last programmed one (device window may be lost)
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_TEMP_Alarm_Centre_Window(const OW_temp_alarm_bus_t * const pBus, OW_temp_t * const pTEMP, const bool force)
+{
+	const int32_t	margin = (pBus->margin != 0U) ? pBus->margin : OW_TEMP_ALARM_MARGIN;
+	const int32_t	temp = (int32_t) pTEMP->tempConv >> pTEMP->props->fracBits;	// Thresholds are compared with temperature integer part
+	const int32_t	Th = min(temp + margin, OW_TEMP_ALARM_MAX);
+	const int32_t	Tl = max(temp - margin, OW_TEMP_ALARM_MIN);
+	FctERR			err = ERROR_OK;
+
+	if (force || (pTEMP->scratch.Th != Th) || (pTEMP->scratch.Tl != Tl))
+	{
+		err = OW_TEMP_Set_Alarm_Window(pTEMP, (int8_t) Tl, (int8_t) Th);
+	}
+
+	return err;
+}
+
+
+/*!\brief Alarm window polling sensors flagging from alarm search
+** \param[in,out] pBus - Pointer to alarm window polling bus structure
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_TEMP_Alarm_Search(OW_temp_alarm_bus_t * const pBus, OW_DRV * const pOW)
+{
+	OW_ROM_ID_t	ROMId;
+	FctERR		err;
+
+	UNUSED_RET memset(pBus->alarmed, 0, sizeof(pBus->alarmed));
+
+	OWSearch_SetType(pOW, OW_TEMP__ALARM_SEARCH);
+
+	err = OWSearch_First(pOW, &ROMId);
+
+	while (err == ERROR_OK)
+	{
+		for (size_t i = 0U ; i < pBus->nb ; i++)
+		{
+			if (memcmp(ROMId.romId, pBus->sensors[i]->slave_inst->cfg.ROM_ID.romId, OW_ROM_ID_SIZE) == 0)
+			{
+				pBus->alarmed[i] = true;
+				break;
+			}
+		}
+
+		if (pOW->search_state.lastDeviceFlag)	{ break; }
+
+		err = OWSearch_Next(pOW, &ROMId);
+	}
+
+	OWSearch_SetType(pOW, OW__SEARCH_ROM);	// Switch back to default search command
+
+	return (err == ERROR_NOTAVAIL) ? ERROR_OK : err;	// No (more) device in alarm
+}
+
+
+/*!\brief Alarm window polling bus wide conversion start
+** \param[in,out] pBus - Pointer to alarm window polling bus structure
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_TEMP_Alarm_Start(OW_temp_alarm_bus_t * const pBus, OW_DRV * const pOW)
+{
+	uint32_t	convTime = 0U;
+	FctERR		err = ERROR_OK;
+
+	if (OW_bus_is_busy(pOW))	// Wait for any bus slave transaction to end (Skip ROM conversion & strong pull-up would disturb it)
+	{
+		pBus->state = OW_TEMP_ALARM__WAIT_BUS;
+		err = ERROR_BUSY;
+		goto ret;
+	}
+
+	for (size_t i = 0U ; i < pBus->nb ; i++)	{ convTime = max(convTime, OW_TEMP_Get_Conversion_Time(pBus->sensors[i])); }
+
+	err = OW_TEMP_Start_Conversion_All(pOW);
+	if (err != ERROR_OK)
+	{
+		pBus->state = OW_TEMP_ALARM__IDLE;
+		goto ret;
+	}
+
+	for (size_t i = 0U ; i < pBus->nb ; i++)	{ OW_set_busy(pBus->sensors[i]->slave_inst, true); }
+
+	pBus->convTime = convTime;
+	pBus->hStart = HALTicks();
+	pBus->state = OW_TEMP_ALARM__CONVERT;
+
+	ret:
+	return err;
+}
+
+
+/*!\brief Alarm window polling sensor window read back (one sensor per cycle, round robin)
+** \note Sensor power loss restores EEPROM Th/Tl in scratchpad: window mismatch requests windows programming at next cycle
+** \param[in,out] pBus - Pointer to alarm window polling bus structure
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_TEMP_Alarm_Audit(OW_temp_alarm_bus_t * const pBus)
+{
+	OW_temp_t * const	pTEMP = pBus->sensors[pBus->auditIdx % pBus->nb];
+	const int8_t		Th = pTEMP->scratch.Th;		// Last programmed window
+	const int8_t		Tl = pTEMP->scratch.Tl;
+	const FctERR		err = OW_TEMP_Read_Scratchpad(pTEMP);
+
+	pBus->auditIdx = (uint8_t) ((pBus->auditIdx + 1U) % pBus->nb);
+
+	if ((err == ERROR_OK) && ((pTEMP->scratch.Th != Th) || (pTEMP->scratch.Tl != Tl)))
+	{
+		pBus->armed = false;
+		pBus->rearms++;
+	}
+
+	return err;
+}
+
+
+/*!\brief Alarm window polling bus wide conversion end (alarm search and alarmed sensors read)
+** \param[in,out] pBus - Pointer to alarm window polling bus structure
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_TEMP_Alarm_End(OW_temp_alarm_bus_t * const pBus, OW_DRV * const pOW)
+{
+	const bool	program = !pBus->armed;	// Windows programmed during this cycle
+	FctERR		err = ERROR_OK;
+
+	pBus->state = OW_TEMP_ALARM__IDLE;
+
+	OW_StrongPull_Set(pOW, false);
+
+	for (size_t i = 0U ; i < pBus->nb ; i++)	{ OW_set_busy(pBus->sensors[i]->slave_inst, false); }
+
+	if (pBus->armed)	{ err = OW_TEMP_Alarm_Search(pBus, pOW); }
+	else				{ UNUSED_RET memset(pBus->alarmed, true, sizeof(pBus->alarmed)); }	// Every sensor read to program windows
+	if (err != ERROR_OK)	{ goto ret; }
+
+	pBus->lastReads = 0U;
+	pBus->armed = true;
+
+	for (size_t i = 0U ; i < pBus->nb ; i++)
+	{
+		if (pBus->alarmed[i])
+		{
+			OW_temp_t * const	pTEMP = pBus->sensors[i];
+			FctERR				err_sensor = OW_TEMP_Read_Conversion(pTEMP);
+
+			if (err_sensor == ERROR_OK)	{ err_sensor = OW_TEMP_Alarm_Centre_Window(pBus, pTEMP, program); }
+			if (err_sensor != ERROR_OK)	{ pBus->armed = false; }	// Window may be off, program all windows at next cycle
+
+			err |= err_sensor;
+			pBus->lastReads++;
+		}
+	}
+
+	if (!program)	{ err |= OW_TEMP_Alarm_Audit(pBus); }
+
+	pBus->reads += pBus->lastReads;
+	pBus->cycles++;
+
+	ret:
+	return err;
+}
+
+
+FctERR NONNULL__ OW_TEMP_Alarm_Cycle(OW_DRV * const pOW)
+{
+	OW_temp_alarm_bus_t * const	pBus = OW_TEMP_Alarm_Get_Bus(pOW);
+	FctERR						err = ERROR_OK;
+
+	if (pBus == NULL)		{ err = ERROR_INSTANCE; }
+	else if (pBus->nb == 0)	{ err = ERROR_NOTAVAIL; }
+	if (err != ERROR_OK)	{ goto ret; }
+
+	if (pBus->state != OW_TEMP_ALARM__CONVERT)
+	{
+		err = OW_TEMP_Alarm_Start(pBus, pOW);
+		if (err == ERROR_OK)	{ err = ERROR_BUSY; }	// Cycle ongoing
+	}
+	else if (TPSINF_MS(pBus->hStart, pBus->convTime))
+	{
+		err = ERROR_BUSY;
+	}
+	else
+	{
+		err = OW_TEMP_Alarm_End(pBus, pOW);
+	}
+
+	ret:
+	return err;
+}
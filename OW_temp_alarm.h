@@ -0,0 +1,141 @@
+/*!\file OW_temp_alarm.h
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire temperature sensors alarm window polling
+** \note Alarm window (Th/Tl) of every registered sensor is centred around its last temperature. After each bus wide conversion,
+**		 alarm search only returns sensors whose temperature moved out of their window: only those are read (and their window re-centred).
+** \note Alarm windows are only written to sensors scratchpad (volatile, EEPROM not worn by re-centring). Each cycle reads back
+**		 the scratchpad of one sensor (round robin): windows lost by sensors power loss (back to EEPROM Th/Tl) are detected
+**		 and programmed again at next cycle (\ref OW_TEMP_Alarm_Rearm may also be called when power loss is known).
+** \note Temperature of sensors not read is known to be within their window (last temperature +/- margin).
+**/
+/****************************************************************/
+#ifndef OW_TEMP_ALARM_H__
+	#define OW_TEMP_ALARM_H__
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+#include "sarmfsw.h"
+
+#include "OW_drv.h"
+#include "OW_dev_temp.h"
+
+
+#ifndef OW_TEMP_ALARM_SENSORS_NB
+#define OW_TEMP_ALARM_SENSORS_NB	128U	//!< Maximum number of temperature sensors handled by alarm window polling on each bus
+#endif
+
+#if (OW_TEMP_ALARM_SENSORS_NB > 255U)
+#error "OW_TEMP_ALARM_SENSORS_NB shall not exceed 255 sensors per bus"
+#endif
+
+#ifndef OW_TEMP_ALARM_MARGIN
+#define OW_TEMP_ALARM_MARGIN		1U		//!< Default alarm window margin around last temperature (in Celsius degrees)
+#endif
+/****************************************************************/
+
+
+// *****************************************************************************
+// Section: Types
+// *****************************************************************************
+/*!\enum OW_temp_alarm_state
+** \brief Alarm window polling bus cycle state
+**/
+typedef enum PACK__ {
+	OW_TEMP_ALARM__IDLE = 0U,	//!< No cycle ongoing (last cycle completed or failed)
+	OW_TEMP_ALARM__WAIT_BUS,	//!< Cycle start deferred (transaction ongoing on a bus slave)
+	OW_TEMP_ALARM__CONVERT,		//!< Bus wide conversion pending
+} OW_temp_alarm_state;
+
+
+/*!\struct OW_temp_alarm_bus_t
+** \brief Alarm window polling bus structure
+**/
+typedef struct {
+	OW_temp_t *	sensors[OW_TEMP_ALARM_SENSORS_NB];	//!< Temperature sensors registered on bus
+	bool		alarmed[OW_TEMP_ALARM_SENSORS_NB];	//!< Sensors found by last alarm search
+	uint8_t		nb;									//!< Number of registered sensors
+	uint8_t		margin;								//!< Alarm window margin (in Celsius degrees, 0: default \ref OW_TEMP_ALARM_MARGIN)
+	uint8_t		lastReads;							//!< Number of sensors read during last cycle
+	uint8_t		auditIdx;							//!< Next sensor which alarm window is checked (read back)
+	bool		armed;								//!< Alarm windows programmed
+	OW_temp_alarm_state	state;						//!< Cycle state
+	uint32_t	hStart;								//!< Bus wide conversion start time
+	uint32_t	convTime;							//!< Bus wide conversion time (longest sensor conversion time, in ms)
+	uint32_t	cycles;								//!< Number of completed cycles
+	uint32_t	reads;								//!< Number of sensors read since start
+	uint32_t	rearms;								//!< Number of lost alarm windows detected (sensors power loss)
+} OW_temp_alarm_bus_t;
+
+
+extern OW_temp_alarm_bus_t OWtempAlarm[OW_BUS_NB];	//!< Alarm window polling structures (one per bus)
+
+
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+/*!\brief Register temperature sensor for alarm window polling
+** \note Sensor is set to single conversion mode, conversions being handled by bus wide cycles
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \return FctERR - error code
+** \retval ERROR_OVERFLOW - \ref OW_TEMP_ALARM_SENSORS_NB sensors already registered on bus
+** \retval ERROR_BUSY - Cycle ongoing on bus
+**/
+FctERR NONNULL__ OW_TEMP_Alarm_Register(OW_temp_t * const pTEMP);
+
+/*!\brief Unregister temperature sensor from alarm window polling
+** \note Nothing done if sensor is not registered
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \return FctERR - error code
+** \retval ERROR_BUSY - Cycle ongoing on bus, to be called again once cycle is done
+**/
+FctERR NONNULL__ OW_TEMP_Alarm_Unregister(const OW_temp_t * const pTEMP);
+
+/*!\brief Alarm window margin setter
+** \note Windows are programmed again at next cycle
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \param[in] margin - Alarm window margin around last temperature (in Celsius degrees)
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_TEMP_Alarm_Set_Margin(const OW_DRV * const pOW, const uint8_t margin);
+
+/*!\brief Alarm windows programming request (e.g. after sensors power loss, windows being volatile)
+** \note Windows are programmed again at next cycle
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_TEMP_Alarm_Rearm(const OW_DRV * const pOW);
+
+/*!\brief Alarm window polling cycle
+** \note Non blocking mode: first call starts bus wide conversion, alarm search and alarmed sensors read are performed by the call
+**		 following longest conversion time. Handler shall be called periodically in a main like loop or from a timer
+** \note First cycle (or cycle following a margin change / rearm request) reads every registered sensor to program alarm windows
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - error code
+** \retval ERROR_OK - Cycle completed
+** \retval ERROR_BUSY - Cycle ongoing, see \ref OW_TEMP_Alarm_Get_State (conversion pending or start deferred by bus slave transaction)
+**/
+FctERR NONNULL__ OW_TEMP_Alarm_Cycle(OW_DRV * const pOW);
+
+/*!\brief Alarm window polling cycle state getter
+** \param[in] pOW - Pointer to OneWire driver instance
+** \return Cycle state (\ref OW_TEMP_ALARM__IDLE if unknown instance)
+**/
+OW_temp_alarm_state NONNULL__ OW_TEMP_Alarm_Get_State(const OW_DRV * const pOW);
+
+/*!\brief Alarm window polling sensor alarmed during last cycle getter
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \return true if sensor was out of its alarm window during last cycle (thus read)
+**/
+bool NONNULL__ OW_TEMP_Alarm_Is_Alarmed(const OW_temp_t * const pTEMP);
+
+
+/****************************************************************/
+#ifdef __cplusplus
+	}
+#endif
+
+#endif
+/****************************************************************/
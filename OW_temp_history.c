@@ -0,0 +1,180 @@
+/*!\file OW_temp_history.c
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire temperature sensor samples history
+**/
+/****************************************************************/
+#include <string.h>
+
+#include "sarmfsw.h"
+
+#include "OW_temp_history.h"
+
+#if OW_TEMP_HISTORY_SIZE
+/****************************************************************/
+
+
+/*!\brief OneWire temperature sensor history statistics update
+** \param[in,out] pHist - Pointer to temperature sensor history
+** \param[in] raw - Temperature register value
+**/
+__STATIC void NONNULL__ OW_TEMP_HIST_Update_Stats(OW_temp_hist_t * const pHist, const int16_t raw)
+{
+	OW_temp_hist_stats_t * const	pStats = &pHist->stats;
+	const uint8_t					shift = (pHist->ewmaShift != 0U) ? pHist->ewmaShift : OW_TEMP_HISTORY_EWMA_SHIFT;
+	const int32_t					sample = (int32_t) raw * 256;	// Q8
+
+	if (pStats->count == 0U)
+	{
+		pStats->min = raw;
+		pStats->max = raw;
+		pStats->ewma = sample;
+	}
+	else
+	{
+		pStats->min = min(pStats->min, raw);
+		pStats->max = max(pStats->max, raw);
+		pStats->ewma += (sample - pStats->ewma) / (int32_t) LSHIFT32(1U, shift);
+	}
+
+	if (pStats->count >= OW_TEMP_HISTORY_STATS_MAX)	// Halve accumulators (mean & variance kept, older samples weight reduced)
+	{
+		pStats->count /= 2U;
+		pStats->sum /= 2;
+		pStats->sumSq /= 2U;
+	}
+
+	pStats->count++;
+	pStats->sum += raw;
+	pStats->sumSq += (uint64_t) ((int32_t) raw * raw);
+}
+
+
+void NONNULL__ OW_TEMP_HIST_Push(OW_temp_hist_t * const pHist, const int16_t raw, const FctERR status)
+{
+	const uint32_t head = pHist->head;
+
+	if ((head - pHist->tail) >= OW_TEMP_HISTORY_SIZE)	{ pHist->overruns++; }	// Ring buffer full, sample dropped
+	else
+	{
+		OW_temp_sample_t * const pSample = &pHist->samples[head & (OW_TEMP_HISTORY_SIZE - 1U)];
+
+		pSample->tick = HALTicks();
+		pSample->status = status;
+		pSample->raw = raw;
+
+		__DMB();			// Sample written before being published
+		pHist->head = head + 1U;
+	}
+
+	if ((status == ERROR_OK) || pHist->resetReq)
+	{
+		pHist->seq++;		// Odd: statistics update ongoing
+		__DMB();
+
+		if (pHist->resetReq)
+		{
+			pHist->resetReq = false;
+			UNUSED_RET memset(&pHist->stats, 0, sizeof(OW_temp_hist_stats_t));
+		}
+
+		if (status == ERROR_OK)	{ OW_TEMP_HIST_Update_Stats(pHist, raw); }
+
+		__DMB();
+		pHist->seq++;		// Even: statistics consistent
+	}
+}
+
+
+size_t NONNULL__ OW_TEMP_HIST_Drain(OW_temp_hist_t * const pHist, OW_temp_sample_t samples[], const size_t max_nb)
+{
+	uint32_t	tail = pHist->tail;
+	size_t		nb = 0U;
+
+	while ((nb < max_nb) && (tail != pHist->head))
+	{
+		__DMB();			// Head read before sample
+		samples[nb++] = pHist->samples[tail & (OW_TEMP_HISTORY_SIZE - 1U)];
+		tail++;
+	}
+
+	__DMB();				// Samples copied before slots are released
+	pHist->tail = tail;
+
+	return nb;
+}
+
+
+FctERR NONNULL__ OW_TEMP_HIST_Get_Stats(const OW_temp_hist_t * const pHist, OW_temp_hist_stats_t * const pStats)
+{
+	FctERR err = ERROR_BUSY;
+
+	for (uintCPU_t i = 0 ; (i < OW_TEMP_HISTORY_RETRIES) && (err != ERROR_OK) ; i++)	// Bounded: producer may be preempted mid-update
+	{
+		const uint32_t seq = pHist->seq;
+		__DMB();
+		UNUSED_RET memcpy(pStats, &pHist->stats, sizeof(OW_temp_hist_stats_t));
+		__DMB();
+
+		if (((seq & 1U) == 0U) && (seq == pHist->seq))	{ err = ERROR_OK; }
+	}
+
+	return err;
+}
+
+
+void NONNULL__ OW_TEMP_HIST_Reset_Stats(OW_temp_hist_t * const pHist)
+{
+	pHist->resetReq = true;		// Statistics only written by producer
+}
+
+
+FctERR NONNULL__ OW_TEMP_HIST_Set_EWMA(OW_temp_hist_t * const pHist, const uint8_t shift)
+{
+	FctERR err = ERROR_OK;
+
+	if (shift > OW_TEMP_HISTORY_EWMA_MAX)	{ err = ERROR_RANGE; }
+	else									{ pHist->ewmaShift = shift; }
+
+	return err;
+}
+
+
+/****************************************************************/
+
+
+int16_t NONNULL__ OW_TEMP_HIST_Mean(const OW_temp_hist_stats_t * const pStats)
+{
+	int16_t mean = 0;
+
+	if (pStats->count != 0U)
+	{
+		const int64_t half = (pStats->sum >= 0) ? (int64_t) (pStats->count / 2U) : -(int64_t) (pStats->count / 2U);
+		mean = (int16_t) ((pStats->sum + half) / (int64_t) pStats->count);	// Rounded to nearest
+	}
+
+	return mean;
+}
+
+
+uint32_t NONNULL__ OW_TEMP_HIST_Variance(const OW_temp_hist_stats_t * const pStats)
+{
+	uint32_t var = 0U;
+
+	if (pStats->count > 1U)
+	{
+		// Population variance: (n * sum(x^2) - sum(x)^2) / n^2 (no overflow with count <= OW_TEMP_HISTORY_STATS_MAX)
+		const uint64_t	n = pStats->count;
+		const uint64_t	sum2 = (uint64_t) (pStats->sum * pStats->sum);
+		const uint64_t	nSumSq = n * pStats->sumSq;
+
+		if (nSumSq > sum2)	{ var = (uint32_t) ((nSumSq - sum2) / (n * n)); }
+	}
+
+	return var;
+}
+
+
+/****************************************************************/
+#endif
+/****************************************************************/
@@ -0,0 +1,164 @@
+/*!\file OW_temp_history.h
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire temperature sensor samples history
+** \note Single producer (acquisition path) / single consumer (reader) ring buffer, no lock needed on either side.
+** \note Streaming statistics are integer only (raw register units), suitable for MCUs without FPU.
+**/
+/****************************************************************/
+#ifndef OW_TEMP_HISTORY_H__
+	#define OW_TEMP_HISTORY_H__
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+#include "sarmfsw.h"
+
+
+#ifndef OW_TEMP_HISTORY_SIZE
+//! \note Define OW_TEMP_HISTORY_SIZE (power of 2) to embed samples history in each temperature sensor
+#define OW_TEMP_HISTORY_SIZE		0U		//!< Number of samples in temperature sensor history (0: disabled)
+#endif
+
+#ifndef OW_TEMP_HISTORY_EWMA_SHIFT
+#define OW_TEMP_HISTORY_EWMA_SHIFT	3U		//!< Default EWMA smoothing factor (alpha = 1 / 2^shift)
+#endif
+
+#ifndef OW_TEMP_HISTORY_RETRIES
+#define OW_TEMP_HISTORY_RETRIES		4U		//!< Maximum number of statistics snapshot attempts (reader preempting producer update)
+#endif
+
+#define OW_TEMP_HISTORY_STATS_MAX	0xFFFFU	//!< Number of samples after which statistics accumulators are halved (keeps accumulators in range)
+#define OW_TEMP_HISTORY_EWMA_MAX	16U		//!< Maximum EWMA smoothing factor (Q8 EWMA divisor kept in range)
+
+#if (OW_TEMP_HISTORY_EWMA_SHIFT == 0U) || (OW_TEMP_HISTORY_EWMA_SHIFT > OW_TEMP_HISTORY_EWMA_MAX)
+#error "OW_TEMP_HISTORY_EWMA_SHIFT shall be in range 1-16"
+#endif
+
+#if (OW_TEMP_HISTORY_SIZE & (OW_TEMP_HISTORY_SIZE - 1U))
+#error "OW_TEMP_HISTORY_SIZE shall be a power of 2"
+#endif
+/****************************************************************/
+
+
+// *****************************************************************************
+// Section: Types
+// *****************************************************************************
+/*!\struct OW_temp_sample_t
+** \brief OneWire temperature sensor history sample
+**/
+typedef struct {
+	uint32_t	tick;			//!< Acquisition time (HAL ticks)
+	FctERR		status;			//!< Acquisition status
+	int16_t		raw;			//!< Temperature register value (last valid value if acquisition failed)
+} OW_temp_sample_t;
+
+
+/*!\struct OW_temp_hist_stats_t
+** \brief OneWire temperature sensor streaming statistics (raw register units)
+**/
+typedef struct {
+	uint32_t	count;			//!< Number of valid samples accumulated
+	int64_t		sum;			//!< Sum of samples
+	uint64_t	sumSq;			//!< Sum of squared samples
+	int32_t		ewma;			//!< Exponentially weighted moving average (Q8)
+	int16_t		min;			//!< Minimum sample
+	int16_t		max;			//!< Maximum sample
+} OW_temp_hist_stats_t;
+
+
+/*!\struct OW_temp_hist_t
+** \brief OneWire temperature sensor samples history
+**/
+typedef struct {
+	OW_temp_sample_t		samples[(OW_TEMP_HISTORY_SIZE != 0U) ? OW_TEMP_HISTORY_SIZE : 1U];	//!< Samples ring buffer
+	volatile uint32_t		head;			//!< Producer index (free running)
+	volatile uint32_t		tail;			//!< Consumer index (free running)
+	volatile uint32_t		seq;			//!< Statistics update sequence (odd while producer updates statistics)
+	volatile bool			resetReq;		//!< Statistics reset requested (applied by producer)
+	uint32_t				overruns;		//!< Number of samples dropped on full ring buffer
+	OW_temp_hist_stats_t	stats;			//!< Streaming statistics
+	uint8_t					ewmaShift;		//!< EWMA smoothing factor (alpha = 1 / 2^ewmaShift, 0: default \ref OW_TEMP_HISTORY_EWMA_SHIFT)
+} OW_temp_hist_t;
+
+
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+/*!\brief OneWire temperature sensor history push sample
+** \note To be called from acquisition path only (single producer)
+** \param[in,out] pHist - Pointer to temperature sensor history
+** \param[in] raw - Temperature register value
+** \param[in] status - Acquisition status (statistics only updated when ERROR_OK)
+**/
+void NONNULL__ OW_TEMP_HIST_Push(OW_temp_hist_t * const pHist, const int16_t raw, const FctERR status);
+
+/*!\brief OneWire temperature sensor history drain samples
+** \note To be called from reader only (single consumer), never blocks acquisition path
+** \param[in,out] pHist - Pointer to temperature sensor history
+** \param[out] samples - Samples output array
+** \param[in] max_nb - Maximum number of samples to drain (most likely number of samples array elements)
+** \return Number of samples drained
+**/
+size_t NONNULL__ OW_TEMP_HIST_Drain(OW_temp_hist_t * const pHist, OW_temp_sample_t samples[], const size_t max_nb);
+
+/*!\brief OneWire temperature sensor history number of pending samples
+** \param[in] pHist - Pointer to temperature sensor history
+** \return Number of samples not drained yet
+**/
+__INLINE uint32_t NONNULL_INLINE__ OW_TEMP_HIST_Pending(const OW_temp_hist_t * const pHist) {
+	return pHist->head - pHist->tail; }
+
+
+/*!\brief OneWire temperature sensor history statistics snapshot
+** \note Lock free: snapshot is retried (up to \ref OW_TEMP_HISTORY_RETRIES attempts) if producer updated statistics meanwhile
+** \param[in] pHist - Pointer to temperature sensor history
+** \param[out] pStats - Pointer to statistics output
+** \return FctERR - error code
+** \retval ERROR_BUSY - Statistics update ongoing (e.g. reader preempting producer), snapshot not consistent
+**/
+FctERR NONNULL__ OW_TEMP_HIST_Get_Stats(const OW_temp_hist_t * const pHist, OW_temp_hist_stats_t * const pStats);
+
+/*!\brief OneWire temperature sensor history statistics reset request
+** \note Reset is only requested (may be called from any context): statistics are reset by producer at next \ref OW_TEMP_HIST_Push,
+**		 keeping a single writer for statistics sequence
+** \param[in,out] pHist - Pointer to temperature sensor history
+**/
+void NONNULL__ OW_TEMP_HIST_Reset_Stats(OW_temp_hist_t * const pHist);
+
+/*!\brief OneWire temperature sensor history EWMA smoothing factor setter
+** \param[in,out] pHist - Pointer to temperature sensor history
+** \param[in] shift - EWMA smoothing factor (alpha = 1 / 2^shift, up to \ref OW_TEMP_HISTORY_EWMA_MAX, 0: default)
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_TEMP_HIST_Set_EWMA(OW_temp_hist_t * const pHist, const uint8_t shift);
+
+
+/*!\brief OneWire temperature sensor statistics mean
+** \param[in] pStats - Pointer to statistics snapshot
+** \return Mean (raw register units)
+**/
+int16_t NONNULL__ OW_TEMP_HIST_Mean(const OW_temp_hist_stats_t * const pStats);
+
+/*!\brief OneWire temperature sensor statistics variance
+** \param[in] pStats - Pointer to statistics snapshot
+** \return Variance (squared raw register units)
+**/
+uint32_t NONNULL__ OW_TEMP_HIST_Variance(const OW_temp_hist_stats_t * const pStats);
+
+/*!\brief OneWire temperature sensor statistics EWMA
+** \param[in] pStats - Pointer to statistics snapshot
+** \return EWMA (raw register units, rounded)
+**/
+__INLINE int16_t NONNULL_INLINE__ OW_TEMP_HIST_EWMA(const OW_temp_hist_stats_t * const pStats) {
+	return (int16_t) ((pStats->ewma + 0x80) >> 8); }
+
+
+/****************************************************************/
+#ifdef __cplusplus
+	}
+#endif
+
+#endif
+/****************************************************************/
@@ -0,0 +1,250 @@
+/*!\file OW_temp_pipeline.c
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire multi-bus temperature acquisition pipeline
+**/
+/****************************************************************/
+#include "sarmfsw.h"
+
+#include "OW_drv.h"
+#include "OW_component.h"
+
+#include "OW_temp_pipeline.h"
+/****************************************************************/
+
+
+OW_temp_pipe_t OWtempPipe = { 0 };		//!< Temperature acquisition pipeline structure
+
+
+/****************************************************************/
+
+
+FctERR NONNULL__ OW_TEMP_Pipeline_Register(OW_temp_t * const pTEMP)
+{
+	const int32_t	idx = pTEMP->slave_inst->cfg.bus_inst - OWdrv;
+	FctERR			err = ERROR_OK;
+
+	if (!IS_OW_DRV_IDX((uint32_t) idx))	{ err = ERROR_INSTANCE; }
+	else
+	{
+		OW_temp_pipe_bus_t * const pBus = &OWtempPipe.bus[idx];
+
+		if (pBus->state != OW_TEMP_PIPE__IDLE)				{ err = ERROR_BUSY; }		// Pipeline running on bus
+		else if (pBus->nb >= OW_TEMP_PIPELINE_SENSORS_NB)	{ err = ERROR_OVERFLOW; }	// No more room on bus
+		else
+		{
+			OW_TEMP_Set_Conversion_Mode(pTEMP, false);
+			pBus->sensors[pBus->nb++] = pTEMP;
+		}
+	}
+
+	return err;
+}
+
+
+FctERR NONNULL__ OW_TEMP_Pipeline_Unregister(const OW_temp_t * const pTEMP)
+{
+	const int32_t	idx = pTEMP->slave_inst->cfg.bus_inst - OWdrv;
+	FctERR			err = ERROR_OK;
+
+	if (!IS_OW_DRV_IDX((uint32_t) idx))	{ err = ERROR_INSTANCE; }
+	else
+	{
+		OW_temp_pipe_bus_t * const pBus = &OWtempPipe.bus[idx];
+
+		for (uint8_t i = 0U ; i < pBus->nb ; i++)
+		{
+			if (pBus->sensors[i] == pTEMP)
+			{
+				if ((pBus->state == OW_TEMP_PIPE__WAIT) || (pBus->state == OW_TEMP_PIPE__READ))	{ err = ERROR_BUSY; }	// Cycle ongoing on bus
+				else
+				{
+					for (uint8_t j = i ; j < (pBus->nb - 1U) ; j++)	{ pBus->sensors[j] = pBus->sensors[j + 1U]; }
+					pBus->nb--;
+				}
+
+				break;
+			}
+		}
+	}
+
+	return err;
+}
+
+
+void OW_TEMP_Pipeline_Start(void)
+{
+	for (size_t i = 0U ; i < OW_BUS_NB ; i++)
+	{
+		OW_temp_pipe_bus_t * const pBus = &OWtempPipe.bus[i];
+
+		pBus->cycles = OWtempPipe.cycle;
+		pBus->err = ERROR_OK;
+		pBus->state = (pBus->nb != 0U) ? OW_TEMP_PIPE__CONVERT : OW_TEMP_PIPE__IDLE;
+	}
+
+	OWtempPipe.err = ERROR_OK;
+	OWtempPipe.run = true;
+}
+
+
+void OW_TEMP_Pipeline_Stop(void)
+{
+	OWtempPipe.run = false;
+
+	for (size_t i = 0U ; i < OW_BUS_NB ; i++)
+	{
+		OW_temp_pipe_bus_t * const pBus = &OWtempPipe.bus[i];
+
+		if (pBus->state == OW_TEMP_PIPE__CONVERT)	{ pBus->state = OW_TEMP_PIPE__IDLE; }	// Other states will end current cycle first
+	}
+}
+
+
+/****************************************************************/
+
+
+/*!\brief Acquisition pipeline bus stage start conversion
+** \param[in,out] pBus - Pointer to bus stage
+** \param[in,out] pOW - Pointer to OneWire driver instance
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_TEMP_Pipeline_Convert(OW_temp_pipe_bus_t * const pBus, OW_DRV * const pOW)
+{
+	// Wait for any transaction of bus slaves to end (pipeline sensors or not): Skip ROM conversion & strong pull-up would disturb them
+	FctERR err = OW_bus_is_busy(pOW) ? ERROR_BUSY : ERROR_OK;
+
+	pBus->convTime = 0U;
+
+	for (size_t i = 0U ; i < pBus->nb ; i++)
+	{
+		pBus->convTime = max(pBus->convTime, OW_TEMP_Get_Conversion_Time(pBus->sensors[i]));
+	}
+
+	if (err == ERROR_OK)
+	{
+		err = OW_TEMP_Start_Conversion_All(pOW);
+
+		if (err != ERROR_OK)
+		{
+			pBus->err |= err;
+			pBus->readIdx = 0U;
+			pBus->state = OW_TEMP_PIPE__READ;	// Read anyway to end cycle (sensors will report their own errors)
+		}
+		else
+		{
+			pBus->hStartConv = HALTicks();
+
+			for (size_t i = 0U ; i < pBus->nb ; i++)
+			{
+				OW_temp_t * const pTEMP = pBus->sensors[i];
+
+				pTEMP->hStartConv = pBus->hStartConv;
+				pTEMP->doneConv = false;
+				OW_set_busy(pTEMP->slave_inst, true);	// Do not release slave at this stage, conversion is ongoing
+			}
+
+			pBus->state = OW_TEMP_PIPE__WAIT;
+		}
+	}
+
+	return (err == ERROR_BUSY) ? ERROR_OK : err;
+}
+
+
+/*!\brief Acquisition pipeline bus stage wait for conversion end
+** \param[in,out] pBus - Pointer to bus stage
+** \param[in,out] pOW - Pointer to OneWire driver instance
+**/
+__STATIC void NONNULL__ OW_TEMP_Pipeline_Wait(OW_temp_pipe_bus_t * const pBus, OW_DRV * const pOW)
+{
+	if (TPSSUP_MS(pBus->hStartConv, pBus->convTime))
+	{
+		OW_StrongPull_Set(pOW, false);
+
+		for (size_t i = 0U ; i < pBus->nb ; i++)
+		{
+			OW_temp_t * const pTEMP = pBus->sensors[i];
+
+			pTEMP->doneConv = true;
+			OW_set_busy(pTEMP->slave_inst, false);
+		}
+
+		pBus->readIdx = 0U;
+		pBus->state = OW_TEMP_PIPE__READ;
+	}
+}
+
+
+/*!\brief Acquisition pipeline bus stage read next sensor
+** \param[in,out] pBus - Pointer to bus stage
+** \return FctERR - error code
+**/
+__STATIC FctERR NONNULL__ OW_TEMP_Pipeline_Read(OW_temp_pipe_bus_t * const pBus)
+{
+	const FctERR err = OW_TEMP_Read_Conversion(pBus->sensors[pBus->readIdx]);
+
+	pBus->err |= err;
+
+	if (++pBus->readIdx >= pBus->nb)
+	{
+		pBus->cycles++;
+		OWtempPipe.err |= pBus->err;
+		pBus->err = ERROR_OK;
+		pBus->state = OWtempPipe.run ? OW_TEMP_PIPE__CONVERT : OW_TEMP_PIPE__IDLE;	// Restart conversions right away to keep bus busy
+	}
+
+	return err;
+}
+
+
+FctERR OW_TEMP_Pipeline_Handler(void)
+{
+	FctERR		err = ERROR_OK;
+	uint32_t	cycle = UINT32_MAX;
+
+	for (size_t i = 0U ; i < OW_BUS_NB ; i++)
+	{
+		OW_temp_pipe_bus_t * const	pBus = &OWtempPipe.bus[i];
+		OW_DRV * const				pOW = &OWdrv[i];
+
+		switch (pBus->state)
+		{
+			case OW_TEMP_PIPE__CONVERT:
+				err |= OW_TEMP_Pipeline_Convert(pBus, pOW);
+				break;
+
+			case OW_TEMP_PIPE__WAIT:
+				OW_TEMP_Pipeline_Wait(pBus, pOW);
+				break;
+
+			case OW_TEMP_PIPE__READ:
+				err |= OW_TEMP_Pipeline_Read(pBus);
+				break;
+
+			default:
+				break;
+		}
+
+		if (pBus->nb != 0U)	{ cycle = min(cycle, pBus->cycles); }
+	}
+
+	if ((cycle != UINT32_MAX) && (cycle != OWtempPipe.cycle))	// Every bus completed a new cycle
+	{
+		const FctERR err_cycle = OWtempPipe.err;
+
+		OWtempPipe.cycle = cycle;
+		OWtempPipe.err = ERROR_OK;
+		OW_TEMP_Pipeline_Cycle_Callback(&OWtempPipe, cycle, err_cycle);
+	}
+
+	return err;
+}
+
+
+__WEAK void NONNULL__ OW_TEMP_Pipeline_Cycle_Callback(const OW_temp_pipe_t * const pPipe, const uint32_t cycle, const FctERR err)
+{
+	UNUSED(pPipe);
+	UNUSED(cycle);
+	UNUSED(err);
+}
@@ -0,0 +1,133 @@
+/*!\file OW_temp_pipeline.h
+** \author SMFSW
+** \copyright MIT (c) 2021-2026, SMFSW
+** \brief OneWire multi-bus temperature acquisition pipeline
+** \note Every bus converts all its registered sensors at once (Skip ROM), then sensors are read one at a time per handler call,
+**		 so that conversion wait on one bus is used to read results on the others.
+** \note Bus wide conversion is only started once no slave registered on bus is busy (\ref OW_bus_is_busy), other slaves transactions
+**		 being held off during conversion (strong pull-up). Temperature sensors on bus not registered in pipeline also convert.
+**/
+/****************************************************************/
+#ifndef OW_TEMP_PIPELINE_H__
+	#define OW_TEMP_PIPELINE_H__
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+#include "sarmfsw.h"
+
+#include "OW_drv.h"
+#include "OW_dev_temp.h"
+
+
+#ifndef OW_TEMP_PIPELINE_SENSORS_NB
+#define OW_TEMP_PIPELINE_SENSORS_NB	8U		//!< Maximum number of temperature sensors handled by pipeline on each bus
+#endif
+/****************************************************************/
+
+
+// *****************************************************************************
+// Section: Types
+// *****************************************************************************
+/*!\enum OW_temp_pipe_state
+** \brief Acquisition pipeline bus states
+**/
+typedef enum {
+	OW_TEMP_PIPE__IDLE = 0U,	//!< Bus stage stopped
+	OW_TEMP_PIPE__CONVERT,		//!< Bus stage starting conversion on all sensors
+	OW_TEMP_PIPE__WAIT,			//!< Bus stage waiting for conversion time to elapse
+	OW_TEMP_PIPE__READ,			//!< Bus stage reading sensors results
+} OW_temp_pipe_state;
+
+
+/*!\struct OW_temp_pipe_bus_t
+** \brief Acquisition pipeline bus stage
+**/
+typedef struct {
+	OW_temp_t *			sensors[OW_TEMP_PIPELINE_SENSORS_NB];	//!< Temperature sensors registered on bus
+	uint8_t				nb;										//!< Number of registered sensors
+	uint8_t				readIdx;								//!< Index of next sensor to read
+	OW_temp_pipe_state	state;									//!< Bus stage state
+	uint32_t			convTime;								//!< Conversion time for current cycle (in ms)
+	uint32_t			hStartConv;								//!< Conversion time start
+	uint32_t			cycles;									//!< Number of completed acquisition cycles
+	FctERR				err;									//!< Errors accumulated during current cycle
+} OW_temp_pipe_bus_t;
+
+
+/*!\struct OW_temp_pipe_t
+** \brief Acquisition pipeline spanning all OneWire buses
+**/
+typedef struct {
+	OW_temp_pipe_bus_t	bus[OW_BUS_NB];		//!< Bus stages
+	uint32_t			cycle;				//!< Last published acquisition cycle
+	FctERR				err;				//!< Errors accumulated by buses since last published cycle
+	bool				run;				//!< Pipeline running flag
+} OW_temp_pipe_t;
+
+
+extern OW_temp_pipe_t OWtempPipe;			//!< Temperature acquisition pipeline structure
+
+
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+/*!\brief Register temperature sensor in acquisition pipeline
+** \note Sensor is set to single conversion mode, conversions being handled by pipeline
+** \param[in,out] pTEMP - Pointer to Temperature device type structure
+** \return FctERR - error code
+**/
+FctERR NONNULL__ OW_TEMP_Pipeline_Register(OW_temp_t * const pTEMP);
+
+/*!\brief Unregister temperature sensor from acquisition pipeline
+** \note Nothing done if sensor is not registered
+** \param[in] pTEMP - Pointer to Temperature device type structure
+** \return FctERR - error code
+** \retval ERROR_BUSY - Bus cycle ongoing (conversion or results read), to be called again once cycle is done
+**/
+FctERR NONNULL__ OW_TEMP_Pipeline_Unregister(const OW_temp_t * const pTEMP);
+
+/*!\brief Start acquisition pipeline on every bus with registered sensors
+**/
+void OW_TEMP_Pipeline_Start(void);
+
+/*!\brief Stop acquisition pipeline
+** \note Buses are stopped once ongoing conversions are read
+**/
+void OW_TEMP_Pipeline_Stop(void);
+
+/*!\brief Acquisition pipeline handler
+** \note Non blocking mode: each call advances every bus stage by one step (at most one sensor read per bus)
+** \note Handler shall be called periodically in a main like loop or from a timer
+** \return FctERR - error code
+**/
+FctERR OW_TEMP_Pipeline_Handler(void);
+
+/*!\brief Acquisition pipeline published cycle getter
+** \return Number of acquisition cycles completed by all buses
+**/
+__INLINE uint32_t OW_TEMP_Pipeline_Get_Cycle(void) {
+	return OWtempPipe.cycle; }
+
+
+/*****************/
+/*** CALLBACKS ***/
+/*****************/
+/*!\brief Acquisition pipeline cycle completion callback
+** \weak Function declared as weak, can be customly implemented in user code to consume combined results
+** \note Called once every bus has completed an acquisition cycle (new data available in each registered sensor)
+** \param[in] pPipe - Pointer to acquisition pipeline
+** \param[in] cycle - Published acquisition cycle
+** \param[in] err - Errors accumulated by buses during cycle
+**/
+void NONNULL__ OW_TEMP_Pipeline_Cycle_Callback(const OW_temp_pipe_t * const pPipe, const uint32_t cycle, const FctERR err);
+
+
+/****************************************************************/
+#ifdef __cplusplus
+	}
+#endif
+
+#endif
+/****************************************************************/
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""OneWire bus trace decoder.
+
+Decodes a raw memory dump of OWtrace structure (OW_drv.c, enabled with OW_DRV_TRACE)
+into a readable timeline, optionally followed by per transaction latency statistics.
+
+Dump layout (little endian): uint32 head, uint32 clock (Hz), then OW_DRV_TRACE events of
+8 bytes each: uint32 ts, uint8 bus, uint8 type, uint8 arg, uint8 val.
+
+Example (gdb): dump binary memory trace.bin &OWtrace ((char *) &OWtrace) + sizeof(OWtrace)
+"""
+import argparse
+import struct
+import sys
+
+HEADER = struct.Struct("<II")
+EVENT = struct.Struct("<IBBBB")
+
+RESET, ROM_CMD, SELECT, SEARCH, WRITE_BYTE, READ_BYTE, WRITE, READ, STRONG_PULL, CRC, ERROR, LOCK_DENIED = range(1, 13)
+
+ROM_CMDS = {0x33: "READ ROM", 0x55: "MATCH ROM", 0xCC: "SKIP ROM", 0xF0: "SEARCH ROM", 0xEC: "ALARM SEARCH", 0xA5: "RESUME"}
+CRC_LAYERS = {1: "ROM Id", 2: "temperature scratchpad", 3: "EEPROM scratchpad"}
+ERRORS = {  # sarmfsw FctERR flags
+    0x0001: "VALUE", 0x0002: "BUSY", 0x0004: "MEMORY", 0x0008: "TIMEOUT", 0x0010: "NOTAVAIL", 0x0020: "INSTANCE",
+    0x0040: "OVERFLOW", 0x0080: "RANGE", 0x0100: "CRC", 0x0200: "BUSOFF", 0x0400: "DISABLED", 0x0800: "PROTECT"}
+
+
+def describe(evt_type, arg, val):
+    """Human readable event description."""
+    if evt_type == RESET:
+        return "RESET        " + ("presence" if arg else "NO PRESENCE")
+    if evt_type == ROM_CMD:
+        return "ROM CMD      0x%02X %s" % (arg, ROM_CMDS.get(arg, ""))
+    if evt_type == SELECT:
+        return "SELECT       family 0x%02X crc 0x%02X" % (arg, val)
+    if evt_type == SEARCH:
+        return "SEARCH FOUND family 0x%02X crc 0x%02X" % (arg, val)
+    if evt_type == WRITE_BYTE:
+        return "WRITE BYTE   0x%02X" % arg
+    if evt_type == READ_BYTE:
+        return "READ BYTE    0x%02X" % arg
+    if evt_type == WRITE:
+        return "WRITE        %s%d bytes (first 0x%02X)" % (">=" if val == 255 else "", val, arg)
+    if evt_type == READ:
+        return "READ         %s%d bytes (first 0x%02X)" % (">=" if val == 255 else "", val, arg)
+    if evt_type == STRONG_PULL:
+        return "STRONG PULL  " + ("on" if arg else "off")
+    if evt_type == CRC:
+        return "CRC FAILURE  " + CRC_LAYERS.get(arg, "layer %d" % arg)
+    if evt_type == ERROR:
+        code = (arg << 8) | val
+        names = [name for bit, name in ERRORS.items() if code & bit]
+        return "ERROR        0x%04X %s" % (code, "|".join(names))
+    if evt_type == LOCK_DENIED:
+        return "LOCK DENIED  owner id %d" % ((arg << 8) | val)
+    return "UNKNOWN      type %d arg 0x%02X val 0x%02X" % (evt_type, arg, val)
+
+
+def load(path, size):
+    """Load dump, return (clock, events oldest first)."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if len(data) < HEADER.size + EVENT.size:
+        sys.exit("dump too short")
+
+    head, clock = HEADER.unpack_from(data, 0)
+    nb_slots = size if size else (len(data) - HEADER.size) // EVENT.size
+
+    if nb_slots & (nb_slots - 1):
+        sys.exit("ring size %d is not a power of 2 (use --size)" % nb_slots)
+
+    nb = min(head, nb_slots)
+    events = []
+    for i in range(head - nb, head):
+        events.append(EVENT.unpack_from(data, HEADER.size + (i & (nb_slots - 1)) * EVENT.size))
+
+    return (clock if clock else 1000), events
+
+
+def latencies(events, clock):
+    """Transaction durations (reset to next reset on same bus) grouped by function command."""
+    ongoing = {}
+    stats = {}
+
+    def close(bus, ts):
+        start, cmd = ongoing.pop(bus)
+        if cmd is not None:
+            us = ((ts - start) & 0xFFFFFFFF) * 1e6 / clock
+            stats.setdefault((bus, cmd), []).append(us)
+
+    for ts, bus, evt_type, arg, _ in events:
+        if evt_type == RESET:
+            if bus in ongoing:
+                close(bus, ts)
+            ongoing[bus] = [ts, None]
+        elif bus in ongoing and ongoing[bus][1] is None and evt_type in (WRITE_BYTE, WRITE):
+            ongoing[bus][1] = arg   # First byte after ROM level: function command
+
+    return stats
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="raw OWtrace memory dump")
+    parser.add_argument("--size", type=int, default=0, help="OW_DRV_TRACE value (default: deduced from dump size)")
+    parser.add_argument("--latency", action="store_true", help="print per transaction latency statistics")
+    args = parser.parse_args()
+
+    clock, events = load(args.dump, args.size)
+
+    if not events:
+        print("no event")
+        return
+
+    t0 = events[0][0]
+    prev = t0
+    for ts, bus, evt_type, arg, val in events:
+        abs_us = ((ts - t0) & 0xFFFFFFFF) * 1e6 / clock
+        delta_us = ((ts - prev) & 0xFFFFFFFF) * 1e6 / clock
+        prev = ts
+        print("%12.1f us  +%10.1f us  bus %d  %s" % (abs_us, delta_us, bus, describe(evt_type, arg, val)))
+
+    if args.latency:
+        print()
+        print("bus  cmd   count      min us      avg us      max us")
+        for (bus, cmd), values in sorted(latencies(events, clock).items()):
+            print("%3d  0x%02X  %5d  %10.1f  %10.1f  %10.1f" % (bus, cmd, len(values), min(values), sum(values) / len(values), max(values)))
+
+
+if __name__ == "__main__":
+    main()